@@ -0,0 +1,185 @@
+// benchmark/bench_support.h
+//
+// Synthetic logger traffic for host_benchmark.yaml and host_static_memory.yaml.
+// Only included by the generated main.cpp of the benchmark configurations.
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <time.h>
+
+#include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/syslog/syslog_component.h"
+
+// Count every heap allocation made by the firmware, and the bytes requested
+static std::atomic<uint32_t> bench_allocations{0};
+static std::atomic<uint32_t> bench_allocated_bytes{0};
+
+void *operator new(size_t size) {
+    bench_allocations++;
+    bench_allocated_bytes += size;
+    void *ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+namespace bench {
+
+/**
+ * @brief One benchmark run: message rate, number of distinct tags and filter list size
+ */
+struct Scenario {
+    uint32_t rate;      // Messages per second
+    uint8_t tags;       // Distinct logger tags the messages are spread over
+    uint8_t filters;    // Non-matching entries in the exclude filter list
+};
+
+static const Scenario SCENARIOS[] = {
+    {100, 1, 0},    {100, 16, 0},    {100, 64, 32},
+    {1000, 1, 0},   {1000, 16, 0},   {1000, 64, 0},   {1000, 64, 32},
+    {5000, 1, 0},   {5000, 16, 0},   {5000, 64, 0},   {5000, 64, 32},
+    {20000, 16, 0}, {20000, 64, 32},
+};
+static const size_t SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+static const uint32_t RUN_TIME_MS = 5000;       // Traffic per scenario
+static const uint32_t DRAIN_TIME_MS = 1000;     // Quiet time for the queue to drain afterwards
+
+// Logger tags have to be static strings
+static const char *const TAGS[64] = {
+    "bench00", "bench01", "bench02", "bench03", "bench04", "bench05", "bench06", "bench07",
+    "bench08", "bench09", "bench10", "bench11", "bench12", "bench13", "bench14", "bench15",
+    "bench16", "bench17", "bench18", "bench19", "bench20", "bench21", "bench22", "bench23",
+    "bench24", "bench25", "bench26", "bench27", "bench28", "bench29", "bench30", "bench31",
+    "bench32", "bench33", "bench34", "bench35", "bench36", "bench37", "bench38", "bench39",
+    "bench40", "bench41", "bench42", "bench43", "bench44", "bench45", "bench46", "bench47",
+    "bench48", "bench49", "bench50", "bench51", "bench52", "bench53", "bench54", "bench55",
+    "bench56", "bench57", "bench58", "bench59", "bench60", "bench61", "bench62", "bench63",
+};
+static const char *const TAG = "bench";
+
+// Capture timestamp, CLOCK_MONOTONIC matches Python's time.monotonic_ns() on Linux
+static uint64_t monotonic_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static size_t scenario = 0;
+static bool running = false;
+static bool finished = false;
+static uint32_t phase_start = 0;
+static uint32_t emitted = 0;
+static uint32_t allocations_start = 0;
+static uint32_t allocations_run = 0;
+static uint32_t dropped_start = 0;
+static uint32_t calls_start = 0;
+static bool setup_measured = false;
+static uint32_t setup_allocations = 0;
+static uint32_t setup_bytes = 0;
+
+// Runtime setting changes made after the last scenario
+static const uint32_t CHANGE_ROUNDS = 100;
+
+// Heap use of setting changes once the component runs. The values are built
+// before counting so only the component's own allocations are measured.
+static void measure_changes(esphome::syslog::SyslogComponent *syslog) {
+    const std::string filter_strings[2] = {"wifi, sensor*, !sensor.temp", "api, ota, mqtt.*"};
+    const std::string prefixes[2] = {"bench", "bench-two"};
+    const std::string client_ids[2] = {"syslog-benchmark", "syslog benchmark 2"};
+    const std::string tag = "extra";
+
+    uint32_t allocations = bench_allocations;
+    uint32_t bytes = bench_allocated_bytes;
+    for (uint32_t i = 0; i < CHANGE_ROUNDS; i++) {
+        syslog->set_filter_string(filter_strings[i % 2]);
+        syslog->add_filter(tag);
+        syslog->remove_filter(tag);
+        syslog->set_logger_log_prefix(prefixes[i % 2]);
+        syslog->set_client_id(client_ids[i % 2]);
+    }
+    allocations = bench_allocations - allocations;
+    bytes = bench_allocated_bytes - bytes;
+
+    syslog->clear_filters();
+    syslog->set_logger_log_prefix("");
+    ESP_LOGI(TAG, "BENCH_HEAP setup_allocs=%u setup_bytes=%u changes=%u change_allocs=%u change_bytes=%u",
+             (unsigned) setup_allocations, (unsigned) setup_bytes, (unsigned) (CHANGE_ROUNDS * 5),
+             (unsigned) allocations, (unsigned) bytes);
+}
+
+static void begin_scenario(esphome::syslog::SyslogComponent *syslog) {
+    const Scenario &s = SCENARIOS[scenario];
+
+    // Exclude list of tags that never match, so only the filter cost changes
+    std::string filters;
+    for (uint8_t i = 0; i < s.filters; i++) {
+        filters += (i ? ",filter" : "filter") + std::to_string(i);
+    }
+    syslog->set_filter_mode(false);
+    syslog->set_filter_string(filters);
+
+    ESP_LOGI(TAG, "BENCH_BEGIN id=%u rate=%u tags=%u filters=%u", (unsigned) scenario, (unsigned) s.rate,
+             (unsigned) s.tags, (unsigned) s.filters);
+    emitted = 0;
+    dropped_start = syslog->get_dropped_count();
+    calls_start = syslog->get_stats().send_calls;
+    allocations_start = bench_allocations;
+    phase_start = esphome::millis();
+    running = true;
+}
+
+static void end_scenario(esphome::syslog::SyslogComponent *syslog) {
+    // Read before logging, the BENCH_END line itself is sent with another system call
+    uint32_t calls = syslog->get_stats().send_calls - calls_start;
+    ESP_LOGI(TAG, "BENCH_END id=%u sent=%u allocs=%u dropped=%u calls=%u", (unsigned) scenario, (unsigned) emitted,
+             (unsigned) allocations_run, (unsigned) (syslog->get_dropped_count() - dropped_start), (unsigned) calls);
+    scenario++;
+    if (scenario == SCENARIO_COUNT) {
+        measure_changes(syslog);
+        ESP_LOGI(TAG, "BENCH_DONE");
+        finished = true;
+    }
+}
+
+// Called from a short interval; emits the messages that are due for the current scenario
+static void tick(esphome::syslog::SyslogComponent *syslog) {
+    if (finished) {
+        return;
+    }
+    if (!setup_measured) {
+        // Everything allocated up to the first tick, by all components, is the setup cost
+        setup_allocations = bench_allocations;
+        setup_bytes = bench_allocated_bytes;
+        setup_measured = true;
+    }
+    if (!running) {
+        begin_scenario(syslog);
+        return;
+    }
+
+    const Scenario &s = SCENARIOS[scenario];
+    uint32_t elapsed = esphome::millis() - phase_start;
+    if (elapsed < RUN_TIME_MS) {
+        uint32_t due = static_cast<uint32_t>(static_cast<uint64_t>(s.rate) * elapsed / 1000);
+        while (emitted < due) {
+            ESP_LOGD(TAGS[emitted % s.tags], "seq=%u t=%llu", (unsigned) emitted,
+                     (unsigned long long) monotonic_us());
+            emitted++;
+        }
+        allocations_run = bench_allocations - allocations_start;
+    } else if (elapsed >= RUN_TIME_MS + DRAIN_TIME_MS) {
+        running = false;
+        end_scenario(syslog);
+    }
+}
+
+}  // namespace bench
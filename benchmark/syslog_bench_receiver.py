@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+Loopback syslog receiver for benchmark/host_benchmark.yaml.
+
+Collects the synthetic messages of every benchmark scenario and reports
+throughput, capture-to-wire latency, heap allocations and send system
+calls per message, and drop counts, followed by the heap used for setup and
+for runtime setting changes. Results can be written as JSON so runs can be diffed.
+"""
+
+import argparse
+import json
+import re
+import socket
+import time
+
+BEGIN_RE = re.compile(rb"BENCH_BEGIN id=(\d+) rate=(\d+) tags=(\d+) filters=(\d+)")
+END_RE = re.compile(rb"BENCH_END id=(\d+) sent=(\d+) allocs=(\d+) dropped=(\d+) calls=(\d+)")
+HEAP_RE = re.compile(rb"BENCH_HEAP setup_allocs=(\d+) setup_bytes=(\d+) changes=(\d+) "
+                     rb"change_allocs=(\d+) change_bytes=(\d+)")
+MESSAGE_RE = re.compile(rb"seq=(\d+) t=(\d+)")
+
+
+def percentile(values, fraction):
+    """Nearest-rank percentile of an already sorted list"""
+    if not values:
+        return 0.0
+    index = min(len(values) - 1, max(0, int(round(fraction * len(values))) - 1))
+    return values[index]
+
+
+class Scenario:
+    def __init__(self, scenario_id, rate, tags, filters):
+        self.id = scenario_id
+        self.rate = rate
+        self.tags = tags
+        self.filters = filters
+        self.received = 0
+        self.latencies_us = []
+        self.first_receive = None
+        self.last_receive = None
+        self.sent = 0
+        self.allocations = 0
+        self.dropped = 0
+        self.calls = 0
+
+    def add_message(self, capture_us, receive_us):
+        self.received += 1
+        self.latencies_us.append(receive_us - capture_us)
+        if self.first_receive is None:
+            self.first_receive = receive_us
+        self.last_receive = receive_us
+
+    def result(self):
+        latencies = sorted(self.latencies_us)
+        duration = (self.last_receive - self.first_receive) / 1e6 if self.received > 1 else 0.0
+        return {
+            "id": self.id,
+            "rate": self.rate,
+            "tags": self.tags,
+            "filters": self.filters,
+            "sent": self.sent,
+            "received": self.received,
+            "lost": max(0, self.sent - self.received),
+            "queue_dropped": self.dropped,
+            "messages_per_s": round(self.received / duration, 1) if duration > 0 else 0.0,
+            "latency_p50_us": percentile(latencies, 0.50),
+            "latency_p99_us": percentile(latencies, 0.99),
+            "allocs_per_message": round(self.allocations / self.sent, 2) if self.sent else 0.0,
+            "syscalls_per_message": round(self.calls / self.sent, 3) if self.sent else 0.0,
+        }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=5514)
+    parser.add_argument("--json", help="Write the results to this file")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4 * 1024 * 1024)
+    sock.bind((args.host, args.port))
+    print(f"Listening on {args.host}:{args.port}, start the benchmark firmware now")
+
+    scenarios = []
+    current = None
+    heap = None
+    while True:
+        data = sock.recv(65535)
+        receive_us = time.monotonic_ns() // 1000
+
+        match = MESSAGE_RE.search(data)
+        if match and current is not None:
+            current.add_message(int(match.group(2)), receive_us)
+            continue
+
+        match = BEGIN_RE.search(data)
+        if match:
+            current = Scenario(*(int(value) for value in match.groups()))
+            scenarios.append(current)
+            continue
+
+        match = END_RE.search(data)
+        if match and current is not None:
+            current.sent, current.allocations, current.dropped, current.calls = (
+                int(value) for value in match.groups()[1:])
+            current = None
+            continue
+
+        match = HEAP_RE.search(data)
+        if match:
+            heap = dict(zip(["setup_allocs", "setup_bytes", "changes", "change_allocs", "change_bytes"],
+                            (int(value) for value in match.groups())))
+            continue
+
+        if b"BENCH_DONE" in data:
+            break
+
+    results = [scenario.result() for scenario in scenarios]
+    columns = ["id", "rate", "tags", "filters", "sent", "received", "lost", "queue_dropped",
+               "messages_per_s", "latency_p50_us", "latency_p99_us", "allocs_per_message", "syscalls_per_message"]
+    print(" ".join(f"{column:>14}" for column in columns))
+    for result in results:
+        print(" ".join(f"{result[column]:>14}" for column in columns))
+
+    if heap is not None:
+        print(f"Heap at setup: {heap['setup_allocs']} allocations, {heap['setup_bytes']} bytes")
+        print(f"Heap for {heap['changes']} setting changes: {heap['change_allocs']} allocations, "
+              f"{heap['change_bytes']} bytes")
+
+    if args.json:
+        with open(args.json, "w") as output:
+            json.dump(results, output, indent=2, sort_keys=True)
+            output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
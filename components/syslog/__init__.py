@@ -9,9 +9,14 @@ from esphome.const import (
     CONF_LEVEL, 
     CONF_PAYLOAD, 
     CONF_TAG,
-    CONF_MODE
+    CONF_MODE,
+    CONF_SIZE,
+    CONF_TIME_ID,
+    CONF_TX_BUFFER_SIZE,
 )
-from esphome.components import logger, text
+from esphome.components import logger, text, time as time_
+from esphome.core import CORE
+from esphome.helpers import cpp_string_escape
 
 # Configuration constants
 CONF_STRIP_COLORS = "strip_colors"
@@ -19,6 +24,7 @@ CONF_ENABLE_LOGGER_MESSAGES = "enable_logger"
 CONF_ENABLE_DIRECT_LOGS = "enable_direct_logs"
 CONF_GLOBALLY_ENABLED = "globally_enabled"
 CONF_MIN_LEVEL = "min_level"
+CONF_LEVELS = "levels"
 CONF_FILTER_MODE = "filter_mode"
 CONF_INCLUDE = "include"
 CONF_EXCLUDE = "exclude"
@@ -27,6 +33,42 @@ CONF_FILTER_STRING = "filter_string"
 CONF_FILTER_TEXT = "filter_text"
 CONF_DIRECT_LOG_PREFIX = "direct_log_prefix"
 CONF_LOGGER_LOG_PREFIX = "logger_log_prefix"
+CONF_QUEUE_SIZE = "queue_size"
+CONF_URGENT_QUEUE_SIZE = "urgent_queue_size"
+CONF_CAPTURE_QUEUE_SIZE = "capture_queue_size"
+CONF_MAX_LOOP_TIME = "max_loop_time"
+CONF_DROP_POLICY = "drop_policy"
+CONF_FACILITY = "facility"
+CONF_REPEAT_WINDOW = "repeat_window"
+CONF_STATS_INTERVAL = "stats_interval"
+CONF_STATS_REPORT = "stats_report"
+CONF_OUTAGE_BUFFER = "outage_buffer"
+CONF_BOOT_BUFFER_SIZE = "boot_buffer_size"
+CONF_PERSISTENT = "persistent"
+CONF_RATE_LIMIT = "rate_limit"
+CONF_TAG_RATE = "tag_rate"
+CONF_TAG_BURST = "tag_burst"
+CONF_GLOBAL_RATE = "global_rate"
+CONF_GLOBAL_BURST = "global_burst"
+CONF_RATE = "rate"
+CONF_BURST = "burst"
+CONF_DESTINATIONS = "destinations"
+CONF_DNS_TTL = "dns_ttl"
+CONF_TRANSPORT = "transport"
+CONF_TCP_BUFFER_SIZE = "tcp_buffer_size"
+CONF_MAX_MESSAGE_SIZE = "max_message_size"
+CONF_OVERSIZE_POLICY = "oversize_policy"
+CONF_TIMESTAMPS = "timestamps"
+CONF_ADAPTIVE_SAMPLING = "adaptive_sampling"
+CONF_MAX_RATIO = "max_ratio"
+CONF_REPORT_INTERVAL = "report_interval"
+CONF_SEQUENCE_IDS = "sequence_ids"
+CONF_STATIC_MEMORY = "static_memory"
+CONF_MAX_FILTERS = "max_filters"
+CONF_FILTER_STORAGE = "filter_storage"
+CONF_MAX_PREFIX_LENGTH = "max_prefix_length"
+CONF_MAX_CLIENT_ID_LENGTH = "max_client_id_length"
+CONF_MAX_ADDRESS_LENGTH = "max_address_length"
 
 # Component dependencies
 DEPENDENCIES = ['logger', 'network', 'socket']
@@ -41,6 +83,59 @@ SyslogAddFilterAction = syslog_ns.class_('SyslogAddFilterAction', automation.Act
 SyslogRemoveFilterAction = syslog_ns.class_('SyslogRemoveFilterAction', automation.Action)
 SyslogClearFiltersAction = syslog_ns.class_('SyslogClearFiltersAction', automation.Action)
 SyslogSetFilterStringAction = syslog_ns.class_('SyslogSetFilterStringAction', automation.Action)
+SyslogSetTagRateLimitAction = syslog_ns.class_('SyslogSetTagRateLimitAction', automation.Action)
+SyslogSetGlobalRateLimitAction = syslog_ns.class_('SyslogSetGlobalRateLimitAction', automation.Action)
+SyslogSetLevelAction = syslog_ns.class_('SyslogSetLevelAction', automation.Action)
+SyslogResetLevelAction = syslog_ns.class_('SyslogResetLevelAction', automation.Action)
+
+# Send queue drop policies
+DropPolicy = syslog_ns.enum('DropPolicy', is_class=True)
+DROP_POLICIES = {
+    "drop_oldest": DropPolicy.DROP_OLDEST,
+    "drop_newest": DropPolicy.DROP_NEWEST,
+}
+
+# Transports to the primary server
+Transport = syslog_ns.enum('Transport', is_class=True)
+TRANSPORTS = {
+    "udp": Transport.UDP,
+    "tcp": Transport.TCP,
+}
+
+# Handling of messages longer than max_message_size
+OversizePolicy = syslog_ns.enum('OversizePolicy', is_class=True)
+OVERSIZE_POLICIES = {
+    "truncate": OversizePolicy.TRUNCATE,
+    "split": OversizePolicy.SPLIT,
+}
+
+# Syslog facility codes (RFC 5424 section 6.2.1)
+FACILITIES = {
+    "kern": 0,
+    "user": 1,
+    "mail": 2,
+    "daemon": 3,
+    "auth": 4,
+    "syslog": 5,
+    "lpr": 6,
+    "news": 7,
+    "uucp": 8,
+    "cron": 9,
+    "authpriv": 10,
+    "ftp": 11,
+    "ntp": 12,
+    "security": 13,
+    "console": 14,
+    "solaris-cron": 15,
+    "local0": 16,
+    "local1": 17,
+    "local2": 18,
+    "local3": 19,
+    "local4": 20,
+    "local5": 21,
+    "local6": 22,
+    "local7": 23,
+}
 
 # Define all log levels in uppercase for validation
 LOG_LEVEL_OPTIONS = [level.upper() for level in logger.LOG_LEVELS]
@@ -73,24 +168,168 @@ def validate_log_level(value):
             return upper_value
     raise cv.Invalid(f"Unknown log level '{value}', valid options are {', '.join(LOG_LEVEL_OPTIONS)}.")
 
+# Tags the syslog.set_level action can override at runtime, and their longest length (tag_levels.h)
+MAX_LEVEL_OVERRIDE_TAG_LENGTH = 31
+
+# Rate limits in messages per second; 0 disables the limit, a burst of 0 allows one second worth of messages
+RATE_LIMIT_SCHEMA = cv.Schema({
+    cv.Optional(CONF_TAG_RATE, default=0): cv.positive_float,
+    cv.Optional(CONF_TAG_BURST, default=0): cv.positive_float,
+    cv.Optional(CONF_GLOBAL_RATE, default=0): cv.positive_float,
+    cv.Optional(CONF_GLOBAL_BURST, default=0): cv.positive_float,
+})
+
+def power_of_two_floor(value):
+    """Rounds down to a power of two; the sampling ratio doubles and halves, so it only takes those values"""
+    return 1 << (value.bit_length() - 1)
+
+# Sampling of DEBUG and lower logger messages while the send path is behind
+ADAPTIVE_SAMPLING_SCHEMA = cv.Schema({
+    cv.Optional(CONF_MAX_RATIO, default=64): cv.All(cv.int_range(min=2, max=1024), power_of_two_floor),
+    cv.Optional(CONF_REPORT_INTERVAL, default="10s"): cv.positive_time_period_milliseconds,
+})
+
+# Largest part of the outage buffer that is kept in flash preferences across reboots
+MAX_PERSISTENT_OUTAGE_SIZE = 4096
+# ESP8266 keeps all preferences in 512 bytes, shared with every other component
+MAX_PERSISTENT_OUTAGE_SIZE_ESP8266 = 256
+
+def validate_outage_buffer(config):
+    """
+    Rejects a persistent outage buffer that doesn't fit in the ESP8266 preference
+    storage; the whole buffer would have to be saved, not just the part that fits.
+    """
+    if config[CONF_PERSISTENT] and CORE.is_esp8266 and config[CONF_SIZE] > MAX_PERSISTENT_OUTAGE_SIZE_ESP8266:
+        raise cv.Invalid(
+            f"A persistent outage buffer is limited to {MAX_PERSISTENT_OUTAGE_SIZE_ESP8266} bytes on ESP8266, "
+            f"set {CONF_SIZE} to at most that or disable {CONF_PERSISTENT}",
+            path=[CONF_SIZE],
+        )
+    return config
+
+OUTAGE_BUFFER_SCHEMA = cv.All(cv.Schema({
+    cv.Optional(CONF_SIZE, default=2048): cv.int_range(min=64, max=65535),
+    cv.Optional(CONF_PERSISTENT, default=False): cv.boolean,
+}), validate_outage_buffer)
+
+# Capacities reserved once when static_memory is enabled; runtime changes that don't fit are rejected
+STATIC_MEMORY_SCHEMA = cv.Schema({
+    cv.Optional(CONF_MAX_FILTERS, default=16): cv.int_range(min=1, max=255),
+    cv.Optional(CONF_FILTER_STORAGE, default=256): cv.int_range(min=16, max=4096),
+    cv.Optional(CONF_MAX_PREFIX_LENGTH, default=32): cv.int_range(min=2, max=255),
+    cv.Optional(CONF_MAX_CLIENT_ID_LENGTH, default=64): cv.int_range(min=1, max=255),
+    cv.Optional(CONF_MAX_ADDRESS_LENGTH, default=64): cv.int_range(min=7, max=255),
+})
+
+def prefix_length(prefix):
+    """Length of a prefix as the component stores it: trimmed, with ": " or " " appended"""
+    prefix = prefix.strip()
+    if not prefix:
+        return 0
+    return len(prefix) + (1 if prefix.endswith(":") else 2)
+
+def filter_items(filter_string):
+    """Non-empty, trimmed items of a comma-separated filter string"""
+    return [item.strip() for item in filter_string.split(",") if item.strip()]
+
+def validate_static_memory(config):
+    """
+    Checks the configured values against the static_memory capacities, so a
+    configuration that would be rejected at boot fails to validate instead.
+    """
+    if CONF_STATIC_MEMORY not in config:
+        return config
+    limits = config[CONF_STATIC_MEMORY]
+    
+    def check_length(key, value, limit_key, length=None):
+        length = len(value.encode("utf-8")) if length is None else length
+        if length > limits[limit_key]:
+            raise cv.Invalid(
+                f"{key} needs {length} bytes, more than {CONF_STATIC_MEMORY}: {limit_key} ({limits[limit_key]})",
+                path=[key],
+            )
+    
+    check_length(CONF_IP_ADDRESS, config[CONF_IP_ADDRESS], CONF_MAX_ADDRESS_LENGTH)
+    if CONF_CLIENT_ID in config:
+        check_length(CONF_CLIENT_ID, config[CONF_CLIENT_ID], CONF_MAX_CLIENT_ID_LENGTH)
+    for key in (CONF_DIRECT_LOG_PREFIX, CONF_LOGGER_LOG_PREFIX):
+        check_length(key, config[key], CONF_MAX_PREFIX_LENGTH, prefix_length(config[key]))
+    
+    # Each tag takes its length plus a terminator in the filter storage
+    if config[CONF_FILTER_STRING]:
+        check_length(CONF_FILTER_STRING, config[CONF_FILTER_STRING], CONF_FILTER_STORAGE)
+        tags = filter_items(config[CONF_FILTER_STRING])
+        key = CONF_FILTER_STRING
+    else:
+        tags = config[CONF_FILTERS]
+        key = CONF_FILTERS
+    if len(tags) > limits[CONF_MAX_FILTERS]:
+        raise cv.Invalid(
+            f"{len(tags)} filter tags, more than {CONF_STATIC_MEMORY}: {CONF_MAX_FILTERS} ({limits[CONF_MAX_FILTERS]})",
+            path=[key],
+        )
+    check_length(key, "", CONF_FILTER_STORAGE, sum(len(tag.encode("utf-8")) + 1 for tag in tags) - 1)
+    return config
+
+# Additional servers; the primary server (ip_address/port) counts towards the limit of 8
+MAX_DESTINATIONS = 7
+
+DESTINATION_SCHEMA = cv.Schema({
+    cv.Required(CONF_IP_ADDRESS): cv.string_strict,
+    cv.Optional(CONF_PORT, default=514): cv.port,
+    cv.Optional(CONF_MIN_LEVEL, default="DEBUG"): validate_log_level,
+    cv.Optional(CONF_FILTER_MODE, default="exclude"): validate_filter_mode,
+    cv.Optional(CONF_FILTERS, default=[]): cv.ensure_list(cv.string),
+})
+
 # Main component configuration schema
-CONFIG_SCHEMA = cv.Schema({
+CONFIG_SCHEMA = cv.All(cv.Schema({
     cv.GenerateID(): cv.declare_id(SyslogComponent),
     cv.Optional(CONF_IP_ADDRESS, default="255.255.255.255"): cv.string_strict,
     cv.Optional(CONF_PORT, default=514): cv.port,
+    cv.Optional(CONF_DNS_TTL, default="5min"): cv.All(
+        cv.positive_time_period_milliseconds, cv.Range(min=cv.TimePeriod(seconds=10))
+    ),
+    cv.Optional(CONF_TRANSPORT, default="udp"): cv.enum(TRANSPORTS, lower=True),
+    cv.Optional(CONF_TCP_BUFFER_SIZE, default=2048): cv.int_range(min=256, max=16384),
     cv.Optional(CONF_CLIENT_ID): cv.string_strict,  # Optional client ID, defaults to device name
+    cv.Optional(CONF_FACILITY, default="kern"): cv.enum(FACILITIES, lower=True),
     cv.Optional(CONF_ENABLE_LOGGER_MESSAGES, default=True): cv.boolean,
     cv.Optional(CONF_ENABLE_DIRECT_LOGS, default=True): cv.boolean,
     cv.Optional(CONF_GLOBALLY_ENABLED, default=True): cv.boolean,
     cv.Optional(CONF_STRIP_COLORS, default=True): cv.boolean,
     cv.Optional(CONF_MIN_LEVEL, default="DEBUG"): validate_log_level,
+    cv.Optional(CONF_LEVELS, default={}): cv.Schema({cv.string_strict: validate_log_level}),
     cv.Optional(CONF_FILTER_MODE, default="exclude"): validate_filter_mode,
     cv.Optional(CONF_FILTERS, default=[]): cv.ensure_list(cv.string),
     cv.Optional(CONF_FILTER_STRING, default=""): cv.string,
     cv.Optional(CONF_FILTER_TEXT): cv.use_id(text.Text),
     cv.Optional(CONF_DIRECT_LOG_PREFIX, default=""): cv.string,
     cv.Optional(CONF_LOGGER_LOG_PREFIX, default=""): cv.string,
-})
+    cv.Optional(CONF_QUEUE_SIZE, default=8): cv.int_range(min=1, max=256),
+    # Added to queue_size, so a burst of errors doesn't shrink the room for everything else
+    cv.Optional(CONF_URGENT_QUEUE_SIZE, default=2): cv.int_range(min=0, max=255),
+    cv.Optional(CONF_CAPTURE_QUEUE_SIZE, default=16): cv.int_range(min=2, max=256),
+    cv.Optional(CONF_MAX_LOOP_TIME, default="2ms"): cv.positive_time_period_microseconds,
+    cv.Optional(CONF_DROP_POLICY, default="drop_oldest"): cv.enum(DROP_POLICIES, lower=True),
+    # Datagram size including the header; 1472 is the largest UDP payload on a 1500 byte MTU
+    cv.Optional(CONF_MAX_MESSAGE_SIZE, default=512): cv.int_range(min=128, max=1472),
+    cv.Optional(CONF_OVERSIZE_POLICY, default="truncate"): cv.enum(OVERSIZE_POLICIES, lower=True),
+    cv.Optional(CONF_TIMESTAMPS, default=False): cv.boolean,
+    cv.Optional(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+    cv.Optional(CONF_SEQUENCE_IDS, default=False): cv.boolean,
+    cv.Optional(CONF_OUTAGE_BUFFER): OUTAGE_BUFFER_SCHEMA,
+    cv.Optional(CONF_BOOT_BUFFER_SIZE, default=0): cv.Any(cv.one_of(0), cv.int_range(min=64, max=65535)),
+    cv.Optional(CONF_STATS_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_STATS_REPORT, default=False): cv.boolean,
+    cv.Optional(CONF_REPEAT_WINDOW, default="0s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_RATE_LIMIT, default={}): RATE_LIMIT_SCHEMA,
+    cv.Optional(CONF_ADAPTIVE_SAMPLING): ADAPTIVE_SAMPLING_SCHEMA,
+    cv.Optional(CONF_DESTINATIONS, default=[]): cv.All(
+        cv.ensure_list(DESTINATION_SCHEMA), cv.Length(max=MAX_DESTINATIONS)
+    ),
+    cv.Optional(CONF_STATIC_MEMORY): STATIC_MEMORY_SCHEMA,
+}), validate_static_memory)
 
 # Action schemas
 SYSLOG_LOG_ACTION_SCHEMA = cv.Schema({
@@ -119,11 +358,38 @@ SYSLOG_SET_FILTER_STRING_SCHEMA = cv.Schema({
     cv.Required(CONF_FILTER_STRING): cv.templatable(cv.string),
 })
 
+SYSLOG_SET_RATE_LIMIT_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.use_id(SyslogComponent),
+    cv.Required(CONF_RATE): cv.templatable(cv.positive_float),
+    cv.Optional(CONF_BURST, default=0): cv.templatable(cv.positive_float),
+})
+
+SYSLOG_SET_LEVEL_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.use_id(SyslogComponent),
+    cv.Required(CONF_TAG): cv.All(cv.string_strict, cv.Length(min=1, max=MAX_LEVEL_OVERRIDE_TAG_LENGTH)),
+    cv.Required(CONF_LEVEL): cv.templatable(validate_log_level),
+})
+
+SYSLOG_RESET_LEVEL_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.use_id(SyslogComponent),
+    cv.Required(CONF_TAG): cv.All(cv.string_strict, cv.Length(min=1, max=MAX_LEVEL_OVERRIDE_TAG_LENGTH)),
+})
+
 def to_code(config):
     """
     Translates the YAML configuration to C++ code for the ESPHome runtime.
     Handles component setup and configuration of all parameters.
     """
+    # Capacities are compile-time constants, the component reserves them when it is created
+    if CONF_STATIC_MEMORY in config:
+        limits = config[CONF_STATIC_MEMORY]
+        cg.add_define("USE_SYSLOG_STATIC_MEMORY")
+        cg.add_define("SYSLOG_STATIC_MAX_FILTERS", limits[CONF_MAX_FILTERS])
+        cg.add_define("SYSLOG_STATIC_FILTER_STORAGE", limits[CONF_FILTER_STORAGE])
+        cg.add_define("SYSLOG_STATIC_PREFIX_LENGTH", limits[CONF_MAX_PREFIX_LENGTH])
+        cg.add_define("SYSLOG_STATIC_CLIENT_ID_LENGTH", limits[CONF_MAX_CLIENT_ID_LENGTH])
+        cg.add_define("SYSLOG_STATIC_ADDRESS_LENGTH", limits[CONF_MAX_ADDRESS_LENGTH])
+    
     var = cg.new_Pvariable(config[CONF_ID])
     yield cg.register_component(var, config)
     
@@ -134,14 +400,90 @@ def to_code(config):
     cg.add(var.set_strip_colors(config[CONF_STRIP_COLORS]))
     cg.add(var.set_server_ip(config[CONF_IP_ADDRESS]))
     cg.add(var.set_server_port(config[CONF_PORT]))
+    cg.add(var.set_dns_ttl(config[CONF_DNS_TTL].total_milliseconds))
+    cg.add(var.set_transport(config[CONF_TRANSPORT]))
+    cg.add(var.set_tcp_buffer_size(config[CONF_TCP_BUFFER_SIZE]))
     
     # Set client ID if provided, otherwise defaults to device name
     if CONF_CLIENT_ID in config:
         cg.add(var.set_client_id(config[CONF_CLIENT_ID]))
     
+    cg.add(var.set_facility(config[CONF_FACILITY]))
+    
+    # Configure the send queue
+    cg.add(var.set_queue_size(config[CONF_QUEUE_SIZE]))
+    cg.add(var.set_urgent_queue_size(config[CONF_URGENT_QUEUE_SIZE]))
+    cg.add(var.set_max_loop_time(config[CONF_MAX_LOOP_TIME].total_microseconds))
+    cg.add(var.set_drop_policy(config[CONF_DROP_POLICY]))
+    
+    # Size the send buffer and queue slots for the largest datagram
+    cg.add_define("SYSLOG_MESSAGE_BUFFER_SIZE", config[CONF_MAX_MESSAGE_SIZE])
+    # The capture ring is allocated in the constructor, before any setter runs
+    cg.add_define("SYSLOG_CAPTURE_QUEUE_SIZE", config[CONF_CAPTURE_QUEUE_SIZE])
+    # Color stripping copies a logger message whole, so the oversize policy sees all of it;
+    # the logger never hands over more than its tx_buffer_size
+    logger_buffer_size = CORE.config.get("logger", {}).get(CONF_TX_BUFFER_SIZE, 512)
+    cg.add_define("SYSLOG_STRIP_BUFFER_SIZE", max(config[CONF_MAX_MESSAGE_SIZE], logger_buffer_size))
+    cg.add(var.set_oversize_policy(config[CONF_OVERSIZE_POLICY]))
+    
+    # Configure capture-time stamping
+    cg.add(var.set_timestamps(config[CONF_TIMESTAMPS]))
+    cg.add(var.set_sequence_ids(config[CONF_SEQUENCE_IDS]))
+    if CONF_TIME_ID in config:
+        time_var = yield cg.get_variable(config[CONF_TIME_ID])
+        cg.add(var.set_time(time_var))
+    
+    # Configure the outage buffer
+    if CONF_OUTAGE_BUFFER in config:
+        outage = config[CONF_OUTAGE_BUFFER]
+        cg.add(var.set_outage_buffer_size(outage[CONF_SIZE]))
+        if outage[CONF_PERSISTENT]:
+            cg.add_define("USE_SYSLOG_OUTAGE_PERSISTENCE")
+            cg.add_define("SYSLOG_OUTAGE_PERSIST_SIZE", min(outage[CONF_SIZE], MAX_PERSISTENT_OUTAGE_SIZE))
+    
+    # Configure statistics publishing
+    cg.add(var.set_stats_interval(config[CONF_STATS_INTERVAL].total_milliseconds))
+    cg.add(var.set_stats_report(config[CONF_STATS_REPORT]))
+    
+    # Configure repeat coalescing
+    cg.add(var.set_repeat_window(config[CONF_REPEAT_WINDOW].total_milliseconds))
+    
+    # Configure rate limiting
+    rate_limit = config[CONF_RATE_LIMIT]
+    cg.add(var.set_tag_rate_limit(rate_limit[CONF_TAG_RATE], rate_limit[CONF_TAG_BURST]))
+    cg.add(var.set_global_rate_limit(rate_limit[CONF_GLOBAL_RATE], rate_limit[CONF_GLOBAL_BURST]))
+    
+    # Configure adaptive sampling
+    if CONF_ADAPTIVE_SAMPLING in config:
+        sampling = config[CONF_ADAPTIVE_SAMPLING]
+        cg.add(var.set_adaptive_sampling(sampling[CONF_MAX_RATIO],
+                                         sampling[CONF_REPORT_INTERVAL].total_milliseconds))
+    
     # Configure log level
     cg.add(var.set_min_log_level(logger.LOG_LEVELS[config[CONF_MIN_LEVEL]]))
     
+    # Per-tag levels become a constant table sorted in strcmp order, searched once per tag
+    if config[CONF_LEVELS]:
+        levels = sorted(config[CONF_LEVELS].items(), key=lambda item: item[0].encode("utf-8"))
+        table_id = f"{config[CONF_ID]}_levels"
+        entries = ", ".join(
+            f"{{{cpp_string_escape(tag)}, {logger.LOG_LEVELS[level]}}}" for tag, level in levels
+        )
+        cg.add_global(cg.RawStatement(
+            f"static constexpr esphome::syslog::TagLevels::Entry {table_id}[] = {{{entries}}};"
+        ))
+        cg.add(var.set_tag_levels(cg.RawExpression(table_id), len(levels)))
+    
+    # Configure additional servers
+    for dest in config[CONF_DESTINATIONS]:
+        cg.add(var.add_destination(
+            dest[CONF_IP_ADDRESS],
+            dest[CONF_PORT],
+            logger.LOG_LEVELS[dest[CONF_MIN_LEVEL]],
+            dest[CONF_FILTER_MODE],
+            dest[CONF_FILTERS],
+        ))
+    
     # Configure filter mode
     cg.add(var.set_filter_mode(config[CONF_FILTER_MODE]))
     
@@ -165,6 +507,10 @@ def to_code(config):
         # Use the original filters list if filter_string is empty
         for filter_tag in config[CONF_FILTERS]:
             cg.add(var.add_filter(filter_tag))
+    
+    # Capture boot messages from here on, once the filters and levels above are in place
+    if config[CONF_BOOT_BUFFER_SIZE] > 0:
+        cg.add(var.set_boot_buffer_size(config[CONF_BOOT_BUFFER_SIZE]))
 
 # Register automation actions
 @automation.register_action('syslog.log', SyslogLogAction, SYSLOG_LOG_ACTION_SCHEMA)
@@ -215,3 +561,47 @@ def syslog_set_filter_string_action_to_code(config, action_id, template_arg, arg
     template_ = yield cg.templatable(config[CONF_FILTER_STRING], args, cg.std_string)
     cg.add(var.set_filter_string(template_))
     yield var
+
+@automation.register_action('syslog.set_tag_rate_limit', SyslogSetTagRateLimitAction, SYSLOG_SET_RATE_LIMIT_SCHEMA)
+def syslog_set_tag_rate_limit_action_to_code(config, action_id, template_arg, args):
+    """Registers the syslog.set_tag_rate_limit action for automations"""
+    paren = yield cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    template_ = yield cg.templatable(config[CONF_RATE], args, cg.float_)
+    cg.add(var.set_rate(template_))
+    template_ = yield cg.templatable(config[CONF_BURST], args, cg.float_)
+    cg.add(var.set_burst(template_))
+    yield var
+
+@automation.register_action('syslog.set_global_rate_limit', SyslogSetGlobalRateLimitAction, SYSLOG_SET_RATE_LIMIT_SCHEMA)
+def syslog_set_global_rate_limit_action_to_code(config, action_id, template_arg, args):
+    """Registers the syslog.set_global_rate_limit action for automations"""
+    paren = yield cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    template_ = yield cg.templatable(config[CONF_RATE], args, cg.float_)
+    cg.add(var.set_rate(template_))
+    template_ = yield cg.templatable(config[CONF_BURST], args, cg.float_)
+    cg.add(var.set_burst(template_))
+    yield var
+
+@automation.register_action('syslog.set_level', SyslogSetLevelAction, SYSLOG_SET_LEVEL_SCHEMA)
+def syslog_set_level_action_to_code(config, action_id, template_arg, args):
+    """Registers the syslog.set_level action for automations"""
+    paren = yield cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    cg.add(var.set_tag(config[CONF_TAG]))
+    level = config[CONF_LEVEL]
+    if cg.is_template(level):
+        template_ = yield cg.templatable(level, args, cg.int_)
+    else:
+        template_ = logger.LOG_LEVELS[level]
+    cg.add(var.set_level(template_))
+    yield var
+
+@automation.register_action('syslog.reset_level', SyslogResetLevelAction, SYSLOG_RESET_LEVEL_SCHEMA)
+def syslog_reset_level_action_to_code(config, action_id, template_arg, args):
+    """Registers the syslog.reset_level action for automations"""
+    paren = yield cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    cg.add(var.set_tag(config[CONF_TAG]))
+    yield var
@@ -0,0 +1,125 @@
+// components/syslog/ansi_strip.cpp
+
+#include "ansi_strip.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace syslog {
+
+static const unsigned char ESC = 0x1B;
+static const unsigned char BEL = 0x07;
+
+/**
+ * @brief Return the index just past the escape sequence starting at src[pos] (which is ESC)
+ *
+ * Malformed sequences end at the offending byte, so it is kept as text (or, if
+ * it is another ESC, parsed as the next sequence).
+ */
+static size_t skip_escape(const char *src, size_t pos, size_t len) {
+    pos++;
+    if (pos >= len) {
+        return len;
+    }
+
+    unsigned char c = static_cast<unsigned char>(src[pos++]);
+    if (c == '[') {
+        // CSI: parameter bytes (0x30-0x3F) and intermediate bytes (0x20-0x2F) up to a final byte
+        while (pos < len) {
+            c = static_cast<unsigned char>(src[pos]);
+            if (c >= 0x40 && c <= 0x7E) {
+                return pos + 1;
+            }
+            if (c < 0x20 || c > 0x3F) {
+                return pos;
+            }
+            pos++;
+        }
+        return len;
+    }
+
+    if (c == ']' || c == 'P' || c == 'X' || c == '^' || c == '_') {
+        // OSC, DCS, SOS, PM and APC strings run until BEL or ST (ESC \)
+        while (pos < len) {
+            c = static_cast<unsigned char>(src[pos]);
+            if (c == BEL) {
+                return pos + 1;
+            }
+            if (c == ESC) {
+                return (pos + 1 < len && src[pos + 1] == '\\') ? pos + 2 : pos;
+            }
+            pos++;
+        }
+        return len;
+    }
+
+    if (c >= 0x20 && c <= 0x2F) {
+        // nF escape: more intermediate bytes, then one final byte
+        while (pos < len) {
+            c = static_cast<unsigned char>(src[pos]);
+            if (c >= 0x30 && c <= 0x7E) {
+                return pos + 1;
+            }
+            if (c < 0x20 || c > 0x2F) {
+                return pos;
+            }
+            pos++;
+        }
+        return len;
+    }
+
+    if (c >= 0x30 && c <= 0x7E) {
+        // Two-byte escape (Fp, Fe, Fs)
+        return pos;
+    }
+
+    // Lone ESC: drop it and keep the following byte
+    return pos - 1;
+}
+
+size_t strip_ansi(const char *src, size_t len, char *scratch, size_t scratch_size, const char **out) {
+    const char *run = src;      // First visible run, returned as a view while it is the only one
+    size_t run_len = 0;
+    bool copying = false;       // Set once a second run forces the text into scratch
+    size_t out_len = 0;
+
+    size_t pos = 0;
+    while (pos < len) {
+        const void *found = memchr(src + pos, ESC, len - pos);
+        size_t end = found != nullptr ? static_cast<const char *>(found) - src : len;
+
+        if (end > pos) {
+            if (run_len == 0) {
+                run = src + pos;
+                run_len = end - pos;
+            } else {
+                if (!copying) {
+                    out_len = run_len < scratch_size ? run_len : scratch_size;
+                    memcpy(scratch, run, out_len);
+                    copying = true;
+                }
+                size_t n = end - pos;
+                if (n > scratch_size - out_len) {
+                    n = scratch_size - out_len;
+                }
+                memcpy(scratch + out_len, src + pos, n);
+                out_len += n;
+            }
+        }
+
+        if (found == nullptr) {
+            break;
+        }
+        pos = skip_escape(src, end, len);
+    }
+
+    if (copying) {
+        *out = scratch;
+        return out_len;
+    }
+    *out = run;
+    return run_len;
+}
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,28 @@
+// components/syslog/ansi_strip.h
+
+#pragma once
+
+#include <cstddef>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief Remove ANSI/ECMA-48 escape sequences from a message in one forward pass
+ *
+ * Handles CSI sequences (ESC [ params intermediates final, e.g. any SGR color
+ * or bold code), OSC/DCS/SOS/PM/APC strings terminated by BEL or ESC \, and
+ * two-byte and nF escapes. A sequence cut off by the end of the message is
+ * dropped.
+ *
+ * When the visible text is a single contiguous run (plain messages, and the
+ * usual ESPHome "color prefix + text + reset" shape) *out points into src and
+ * nothing is copied. Otherwise the text is assembled in scratch, truncated to
+ * scratch_size bytes.
+ *
+ * @return Length of the stripped text at *out
+ */
+size_t strip_ansi(const char *src, size_t len, char *scratch, size_t scratch_size, const char **out);
+
+}  // namespace syslog
+}  // namespace esphome
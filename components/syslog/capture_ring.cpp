@@ -0,0 +1,123 @@
+// components/syslog/capture_ring.cpp
+
+#include "capture_ring.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace esphome {
+namespace syslog {
+
+bool CaptureRing::init(size_t capacity, size_t slot_size) {
+    if (this->is_initialized()) {
+        return true;
+    }
+    if (capacity == 0 || slot_size < 2 || slot_size > UINT16_MAX) {
+        return false;
+    }
+
+    // Positions are mapped to slots with a mask
+    size_t slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+
+    this->slots_.reset(new (std::nothrow) Slot[slots]);
+    this->text_.reset(new (std::nothrow) char[slots * slot_size]);
+    if (!this->slots_ || !this->text_) {
+        this->slots_.reset();
+        this->text_.reset();
+        return false;
+    }
+
+    for (size_t i = 0; i < slots; i++) {
+        this->slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    this->mask_ = slots - 1;
+    this->slot_size_ = slot_size;
+    this->write_pos_.store(0, std::memory_order_relaxed);
+    this->read_pos_ = 0;
+    // Publishes the storage to producers on other threads
+    this->ready_.store(true, std::memory_order_release);
+    return true;
+}
+
+bool CaptureRing::push(uint8_t level, uint8_t source, uint32_t captured_ms, const char *tag, size_t tag_len,
+                       bool static_tag, const char *text, size_t text_len) {
+    if (!this->is_initialized()) {
+        this->dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Claim a slot: it is free for position pos once its sequence equals pos
+    size_t pos = this->write_pos_.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+        slot = &this->slots_[pos & this->mask_];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (this->write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The consumer hasn't freed this slot yet, the ring is full
+            this->dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            // Another producer claimed it first
+            pos = this->write_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // The slot belongs to this producer until it is published
+    char *dst = &this->text_[(pos & this->mask_) * this->slot_size_];
+    size_t room = this->slot_size_ - 1;
+    slot->level = level;
+    slot->source = source;
+    slot->captured_ms = captured_ms;
+    if (static_tag) {
+        slot->tag = tag;
+        slot->tag_len = 0;
+    } else {
+        slot->tag = nullptr;
+        slot->tag_len = static_cast<uint8_t>(std::min({tag_len, room, static_cast<size_t>(UINT8_MAX)}));
+        memcpy(dst, tag, slot->tag_len);
+        room -= slot->tag_len;
+    }
+    slot->text_len = static_cast<uint16_t>(std::min(text_len, room));
+    memcpy(dst + slot->tag_len, text, slot->text_len);
+    dst[slot->tag_len + slot->text_len] = '\0';
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool CaptureRing::front(Entry *entry) const {
+    if (!this->is_initialized()) {
+        return false;
+    }
+    const Slot &slot = this->slots_[this->read_pos_ & this->mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != this->read_pos_ + 1) {
+        return false;
+    }
+    entry->level = slot.level;
+    entry->source = slot.source;
+    entry->captured_ms = slot.captured_ms;
+    entry->tag = slot.tag;
+    entry->tag_len = slot.tag_len;
+    entry->text_len = slot.text_len;
+    entry->text = &this->text_[(this->read_pos_ & this->mask_) * this->slot_size_];
+    return true;
+}
+
+void CaptureRing::pop() {
+    Slot &slot = this->slots_[this->read_pos_ & this->mask_];
+    // Hand the slot to the producer that will claim it one lap later
+    slot.sequence.store(this->read_pos_ + this->mask_ + 1, std::memory_order_release);
+    this->read_pos_++;
+}
+
+}  // namespace syslog
+}  // namespace esphome
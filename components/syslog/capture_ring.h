@@ -0,0 +1,82 @@
+// components/syslog/capture_ring.h
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief Lock-free multi-producer, single-consumer ring of raw log messages
+ *
+ * Any thread or task can push(); only the loop thread pops. A producer claims
+ * a slot with one compare-and-swap on the write position, copies its message
+ * into the slot it now owns, and publishes it by storing the slot's sequence
+ * number (bounded queue after D. Vyukov). Producers never wait for each other
+ * or for the consumer: when the ring is full, the new message is dropped and
+ * counted.
+ *
+ * Storage is allocated once by init(); push() and pop() never touch the heap.
+ */
+class CaptureRing {
+    public:
+        /**
+         * @brief One captured message, as seen by the consumer
+         */
+        struct Entry {
+            uint8_t level;
+            uint8_t source;         // LogSource of the message
+            uint32_t captured_ms;   // millis() when the message was pushed
+            const char *tag;        // Static logger tag, or nullptr if the tag was copied into text
+            uint8_t tag_len;        // Length of the copied tag at the start of text
+            uint16_t text_len;      // Length of text after the tag (not counting the NUL)
+            const char *text;       // Copied tag followed by the NUL-terminated message
+        };
+
+        // Allocate capacity slots (rounded up to a power of two) holding slot_size bytes of text each
+        bool init(size_t capacity, size_t slot_size);
+        bool is_initialized() const { return this->ready_.load(std::memory_order_acquire); }
+
+        // Copy a message into the ring; tag is kept as a pointer if static_tag is set, otherwise copied.
+        // Returns false if the ring is full or not initialized. Safe to call from any thread.
+        bool push(uint8_t level, uint8_t source, uint32_t captured_ms, const char *tag, size_t tag_len,
+                  bool static_tag, const char *text, size_t text_len);
+
+        // Peek at the oldest published message; only the consumer may call this and pop()
+        bool front(Entry *entry) const;
+        void pop();
+
+        uint32_t get_dropped_count() const { return this->dropped_.load(std::memory_order_relaxed); }
+        size_t capacity() const { return this->mask_ + 1; }
+        // Bytes allocated by init()
+        size_t allocated_bytes() const {
+            return this->slot_size_ ? this->capacity() * (sizeof(Slot) + this->slot_size_) : 0;
+        }
+
+    protected:
+        struct Slot {
+            std::atomic<size_t> sequence;   // pos when free for the producer of pos, pos + 1 once published
+            uint8_t level;
+            uint8_t source;
+            uint8_t tag_len;
+            uint16_t text_len;
+            uint32_t captured_ms;
+            const char *tag;
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        std::unique_ptr<char[]> text_;      // (mask_ + 1) * slot_size_ bytes
+        size_t mask_ = 0;
+        size_t slot_size_ = 0;
+        std::atomic<bool> ready_{false};
+        std::atomic<size_t> write_pos_{0};  // Next position a producer claims
+        size_t read_pos_ = 0;               // Next position the consumer reads (consumer only)
+        std::atomic<uint32_t> dropped_{0};  // Messages lost because the ring was full
+};
+
+}  // namespace syslog
+}  // namespace esphome
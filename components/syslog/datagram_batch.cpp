@@ -0,0 +1,97 @@
+// components/syslog/datagram_batch.cpp
+
+#include "datagram_batch.h"
+
+#include <cerrno>
+#include <cstring>
+
+namespace esphome {
+namespace syslog {
+
+bool DatagramBatch::add(const char *data, size_t len, const struct sockaddr_storage *address, socklen_t socklen,
+                        uint8_t message, uint8_t destination) {
+    if (this->count_ == SYSLOG_SEND_BATCH) {
+        return false;
+    }
+    Entry &entry = this->entries_[this->count_++];
+    entry.data = data;
+    entry.len = len;
+    entry.address = address;
+    entry.socklen = socklen;
+    entry.message = message;
+    entry.destination = destination;
+    entry.sent = false;
+    entry.deferred = false;
+    return true;
+}
+
+// A full send buffer fails every datagram after it as well, there's no point trying them now
+static bool send_buffer_full() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+
+void DatagramBatch::defer_from_(size_t pos) {
+    for (size_t i = pos; i < this->count_; i++) {
+        this->entries_[i].deferred = true;
+    }
+}
+
+size_t DatagramBatch::send(socket::Socket *socket) {
+    if (this->count_ == 0) {
+        return 0;
+    }
+
+#ifdef SYSLOG_USE_SENDMMSG
+    int fd = socket->get_fd();
+    if (fd >= 0) {
+        for (size_t i = 0; i < this->count_; i++) {
+            const Entry &entry = this->entries_[i];
+            this->iovecs_[i].iov_base = const_cast<char *>(entry.data);
+            this->iovecs_[i].iov_len = entry.len;
+            memset(&this->headers_[i], 0, sizeof(this->headers_[i]));
+            this->headers_[i].msg_hdr.msg_name = const_cast<struct sockaddr_storage *>(entry.address);
+            this->headers_[i].msg_hdr.msg_namelen = entry.socklen;
+            this->headers_[i].msg_hdr.msg_iov = &this->iovecs_[i];
+            this->headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // sendmmsg() stops at the first datagram that fails. A full send buffer defers the rest to a
+        // later batch; any other error only skips that datagram.
+        size_t calls = 0;
+        size_t pos = 0;
+        while (pos < this->count_) {
+            int sent = ::sendmmsg(fd, &this->headers_[pos], this->count_ - pos, 0);
+            calls++;
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            size_t done = sent > 0 ? static_cast<size_t>(sent) : 0;
+            for (size_t i = pos; i < pos + done; i++) {
+                this->entries_[i].sent = true;
+            }
+            pos += done;
+            if (pos < this->count_ && sent <= 0) {
+                if (send_buffer_full()) {
+                    this->defer_from_(pos);
+                    break;
+                }
+                pos++;
+            }
+        }
+        return calls;
+    }
+#endif
+
+    // One system call per datagram
+    for (size_t i = 0; i < this->count_; i++) {
+        Entry &entry = this->entries_[i];
+        entry.sent = socket->sendto(entry.data, entry.len, 0, reinterpret_cast<const struct sockaddr *>(entry.address),
+                                    entry.socklen) >= 0;
+        if (!entry.sent && send_buffer_full()) {
+            this->defer_from_(i);
+            return i + 1;
+        }
+    }
+    return this->count_;
+}
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,76 @@
+// components/syslog/datagram_batch.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/defines.h"
+#include "esphome/core/version.h"
+#include "esphome/components/socket/socket.h"
+
+// The host platform hands a whole batch to the kernel in one call; the socket's
+// descriptor is only exposed by newer ESPHome versions
+#if defined(USE_HOST) && defined(__linux__) && ESPHOME_VERSION_CODE >= VERSION_CODE(2025, 7, 0)
+#define SYSLOG_USE_SENDMMSG
+#include <sys/socket.h>
+#endif
+
+namespace esphome {
+namespace syslog {
+
+// Most datagrams sent through one socket in one batch
+static const size_t SYSLOG_SEND_BATCH = 32;
+
+/**
+ * @brief Datagrams collected for one socket and sent together
+ *
+ * add() only records pointers, the data must stay in place until send().
+ * On the host platform send() passes the whole batch to sendmmsg(), which
+ * costs one system call instead of one per datagram; elsewhere (lwIP) it
+ * falls back to one sendto() per datagram. Either way every entry reports
+ * whether it was sent, or was deferred because the socket couldn't take more.
+ */
+class DatagramBatch {
+    public:
+        /**
+         * @brief One datagram and where it goes
+         */
+        struct Entry {
+            const char *data;
+            size_t len;
+            const struct sockaddr_storage *address;
+            socklen_t socklen;
+            uint8_t message;        // Caller's index of the message
+            uint8_t destination;    // Caller's destination bit number
+            bool sent;
+            bool deferred;          // Not tried because the socket's send buffer was full
+        };
+
+        void clear() { this->count_ = 0; }
+        size_t size() const { return this->count_; }
+        size_t room() const { return SYSLOG_SEND_BATCH - this->count_; }
+        const Entry &operator[](size_t index) const { return this->entries_[index]; }
+
+        // Record a datagram; returns false if the batch is full
+        bool add(const char *data, size_t len, const struct sockaddr_storage *address, socklen_t socklen,
+                 uint8_t message, uint8_t destination);
+
+        // Send every entry through socket and set its sent flag; returns the number of system calls made.
+        // Once the send buffer is full (EAGAIN), the remaining entries are marked deferred instead of tried.
+        size_t send(socket::Socket *socket);
+
+    protected:
+        // Mark the entries from pos on as deferred
+        void defer_from_(size_t pos);
+
+        Entry entries_[SYSLOG_SEND_BATCH];
+        size_t count_ = 0;
+#ifdef SYSLOG_USE_SENDMMSG
+        struct mmsghdr headers_[SYSLOG_SEND_BATCH];
+        struct iovec iovecs_[SYSLOG_SEND_BATCH];
+#endif
+};
+
+}  // namespace syslog
+}  // namespace esphome
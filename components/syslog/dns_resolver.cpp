@@ -0,0 +1,192 @@
+// components/syslog/dns_resolver.cpp
+
+#include "dns_resolver.h"
+
+#include "esphome/core/defines.h"
+#include <cstring>
+
+#ifdef USE_HOST
+#include <netdb.h>
+#include <thread>
+#else
+#include <lwip/dns.h>
+#include <lwip/ip_addr.h>
+#include <lwip/tcpip.h>
+#endif
+
+namespace esphome {
+namespace syslog {
+
+// Set the port of an already resolved address
+static void set_address_port(struct sockaddr_storage *address, uint16_t port) {
+    if (address->ss_family == AF_INET) {
+        reinterpret_cast<sockaddr_in *>(address)->sin_port = htons(port);
+    }
+#if USE_NETWORK_IPV6
+    else if (address->ss_family == AF_INET6) {
+        reinterpret_cast<sockaddr_in6 *>(address)->sin6_port = htons(port);
+    }
+#endif
+}
+
+#ifdef USE_HOST
+// Runs on its own thread; getaddrinfo() goes through nsswitch, so /etc/hosts entries resolve
+static void resolve_blocking(std::shared_ptr<DnsResolver::Lookup> lookup) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    struct addrinfo *result = nullptr;
+    if (getaddrinfo(lookup->hostname.c_str(), nullptr, &hints, &result) == 0 && result != nullptr) {
+        if (result->ai_addrlen <= sizeof(lookup->address)) {
+            memcpy(&lookup->address, result->ai_addr, result->ai_addrlen);
+            lookup->socklen = result->ai_addrlen;
+            set_address_port(&lookup->address, lookup->port);
+        }
+        freeaddrinfo(result);
+    }
+    lookup->done.store(true, std::memory_order_release);
+}
+#else
+// Convert an lwIP address into a sockaddr; returns its length
+static socklen_t to_sockaddr(const ip_addr_t *ip, uint16_t port, struct sockaddr_storage *out) {
+    memset(out, 0, sizeof(*out));
+#if LWIP_IPV6
+    if (IP_IS_V6(ip)) {
+        auto *addr6 = reinterpret_cast<sockaddr_in6 *>(out);
+        addr6->sin6_family = AF_INET6;
+        addr6->sin6_port = htons(port);
+        memcpy(&addr6->sin6_addr, ip_2_ip6(ip)->addr, sizeof(addr6->sin6_addr));
+        return sizeof(*addr6);
+    }
+#endif
+    auto *addr4 = reinterpret_cast<sockaddr_in *>(out);
+    addr4->sin_family = AF_INET;
+    addr4->sin_port = htons(port);
+    addr4->sin_addr.s_addr = ip4_addr_get_u32(ip_2_ip4(ip));
+    return sizeof(*addr4);
+}
+
+// Called by lwIP (from the TCP/IP task on ESP32) once the lookup finished; arg owns a reference to the lookup
+static void dns_found(const char *name, const ip_addr_t *ip, void *arg) {
+    auto *ref = static_cast<std::shared_ptr<DnsResolver::Lookup> *>(arg);
+    DnsResolver::Lookup &lookup = **ref;
+    if (ip != nullptr) {
+        lookup.socklen = to_sockaddr(ip, lookup.port, &lookup.address);
+    }
+    lookup.done.store(true, std::memory_order_release);
+    delete ref;
+}
+#endif
+
+void DnsResolver::set_host(const std::string &hostname, uint16_t port) {
+    if (hostname == this->hostname_) {
+        // Same name, only the port may have changed
+        this->port_ = port;
+        if (this->socklen_) {
+            set_address_port(&this->address_, port);
+        }
+        return;
+    }
+
+    this->clear();
+    this->hostname_ = hostname;
+    this->port_ = port;
+}
+
+void DnsResolver::clear() {
+    // A running lookup keeps its own reference and finishes on its own
+    this->lookup_.reset();
+    this->hostname_.clear();
+    this->socklen_ = 0;
+    this->failed_ = false;
+}
+
+bool DnsResolver::poll(uint32_t now) {
+    if (!this->is_active()) {
+        return false;
+    }
+
+    if (this->lookup_) {
+        if (!this->lookup_->done.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::shared_ptr<Lookup> lookup = std::move(this->lookup_);
+        if (lookup->socklen == 0) {
+            // Keep using the previous address, if any, until a retry succeeds
+            this->failed_ = true;
+            this->failed_at_ = now;
+            return false;
+        }
+        this->failed_ = false;
+        this->resolved_at_ = now;
+        bool changed = this->socklen_ != lookup->socklen ||
+                       memcmp(&this->address_, &lookup->address, lookup->socklen) != 0;
+        this->address_ = lookup->address;
+        this->socklen_ = lookup->socklen;
+        // The port may have changed while the lookup was running
+        set_address_port(&this->address_, this->port_);
+        return changed;
+    }
+
+    if (this->failed_) {
+        if (now - this->failed_at_ >= SYSLOG_DNS_RETRY_INTERVAL) {
+            this->start_();
+        }
+    } else if (!this->socklen_ || now - this->resolved_at_ >= this->ttl_ms_) {
+        this->start_();
+    }
+    return false;
+}
+
+void DnsResolver::start_() {
+    auto lookup = std::make_shared<Lookup>();
+    lookup->hostname = this->hostname_;
+    lookup->port = this->port_;
+    this->lookup_ = lookup;
+
+#ifdef USE_HOST
+    std::thread(resolve_blocking, std::move(lookup)).detach();
+#else
+    ip_addr_t ip;
+    auto *ref = new std::shared_ptr<Lookup>(lookup);
+#if defined(USE_ESP32) && defined(CONFIG_LWIP_TCPIP_CORE_LOCKING)
+    LOCK_TCPIP_CORE();
+#endif
+    err_t err = dns_gethostbyname(lookup->hostname.c_str(), &ip, dns_found, ref);
+#if defined(USE_ESP32) && defined(CONFIG_LWIP_TCPIP_CORE_LOCKING)
+    UNLOCK_TCPIP_CORE();
+#endif
+    if (err == ERR_INPROGRESS) {
+        // dns_found() completes the lookup and drops its reference
+        return;
+    }
+    // Answered from the lwIP cache, or failed right away; the callback won't run
+    if (err == ERR_OK) {
+        lookup->socklen = to_sockaddr(&ip, lookup->port, &lookup->address);
+    }
+    lookup->done.store(true, std::memory_order_release);
+    delete ref;
+#endif
+}
+
+socklen_t DnsResolver::get_address(struct sockaddr_storage *out) const {
+    if (this->socklen_) {
+        *out = this->address_;
+    }
+    return this->socklen_;
+}
+
+DnsResolver::State DnsResolver::get_state() const {
+    if (!this->is_active()) {
+        return State::IDLE;
+    }
+    if (this->socklen_) {
+        return State::RESOLVED;
+    }
+    return this->failed_ ? State::FAILED : State::PENDING;
+}
+
+}  // namespace syslog
+}  // namespace esphome
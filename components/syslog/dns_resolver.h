@@ -0,0 +1,84 @@
+// components/syslog/dns_resolver.h
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "esphome/components/socket/socket.h"
+
+namespace esphome {
+namespace syslog {
+
+// How long a failed lookup waits before it is retried (ms)
+static const uint32_t SYSLOG_DNS_RETRY_INTERVAL = 10000;
+
+/**
+ * @brief Resolves the server hostname in the background and caches the result
+ *
+ * poll() is called from loop(). It starts a lookup when there is no address
+ * yet or the cached one is older than the TTL, and picks up finished lookups.
+ * The caller is never blocked: on the host platform getaddrinfo() runs on a
+ * short-lived thread (so /etc/hosts is honoured), on lwIP targets
+ * dns_gethostbyname() reports back through its callback. While a refresh is
+ * running, or after it failed, the previous address stays in use.
+ */
+class DnsResolver {
+    public:
+        enum class State : uint8_t {
+            IDLE,       // No hostname set
+            PENDING,    // Lookup running and no address known yet
+            RESOLVED,   // Address available (possibly being refreshed)
+            FAILED      // Last lookup failed and no address is known
+        };
+
+        // Resolve hostname from now on; keeps the cached address if the name didn't change
+        void set_host(const std::string &hostname, uint16_t port);
+        // Forget the hostname and the cached address (the server is a literal IP)
+        void clear();
+        bool is_active() const { return !this->hostname_.empty(); }
+        const std::string &get_hostname() const { return this->hostname_; }
+
+        // How long a resolved address is used before it is looked up again (ms)
+        void set_ttl(uint32_t ttl_ms) { this->ttl_ms_ = ttl_ms; }
+        uint32_t get_ttl() const { return this->ttl_ms_; }
+
+        // Start or collect lookups as needed; returns true when a new address became available
+        bool poll(uint32_t now);
+
+        bool has_address() const { return this->socklen_ != 0; }
+        // Copy the cached address into out; returns its length (0 if unresolved)
+        socklen_t get_address(struct sockaddr_storage *out) const;
+        State get_state() const;
+
+        /**
+         * @brief One lookup, shared with the thread or lwIP callback that completes it
+         *
+         * The result fields are written before done is set and only read after.
+         */
+        struct Lookup {
+            std::string hostname;
+            uint16_t port = 0;
+            struct sockaddr_storage address;
+            socklen_t socklen = 0;              // 0 if the lookup failed
+            std::atomic<bool> done{false};
+        };
+
+    protected:
+        void start_();
+
+        std::string hostname_;
+        uint16_t port_ = 0;
+        uint32_t ttl_ms_ = 300000;
+        std::shared_ptr<Lookup> lookup_;        // Running lookup, if any
+        struct sockaddr_storage address_;       // Last resolved address
+        socklen_t socklen_ = 0;                 // 0 if nothing was resolved yet
+        uint32_t resolved_at_ = 0;              // millis() of the last successful lookup
+        uint32_t failed_at_ = 0;                // millis() of the last failed lookup
+        bool failed_ = false;                   // Last lookup failed
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,87 @@
+// components/syslog/filter_list.cpp
+
+#include "filter_list.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace syslog {
+
+// Same order as std::string::compare
+static int compare_tags(const char *a, size_t a_len, const char *b, size_t b_len) {
+    int cmp = memcmp(a, b, a_len < b_len ? a_len : b_len);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return a_len < b_len ? -1 : (a_len > b_len ? 1 : 0);
+}
+
+void FilterList::reserve(size_t bytes, size_t count) {
+    this->data_.reserve(bytes);
+    this->max_bytes_ = bytes;
+    this->max_count_ = count;
+}
+
+size_t FilterList::strnlen_(const char *str, size_t max) {
+    const char *end = static_cast<const char *>(memchr(str, '\0', max));
+    return end != nullptr ? static_cast<size_t>(end - str) : max;
+}
+
+size_t FilterList::find_(const char *tag, size_t len, bool *found) const {
+    // Linear, the list is short and only searched when it changes
+    const char *data = this->data_.data();
+    size_t pos = 0;
+    while (pos < this->data_.size()) {
+        size_t entry_len = strnlen_(data + pos, this->data_.size() - pos);
+        int cmp = compare_tags(data + pos, entry_len, tag, len);
+        if (cmp >= 0) {
+            *found = cmp == 0;
+            return pos;
+        }
+        pos += entry_len + 1;
+    }
+    *found = false;
+    return pos;
+}
+
+bool FilterList::add(const char *tag, size_t len) {
+    bool found;
+    size_t pos = this->find_(tag, len, &found);
+    if (found) {
+        return true;
+    }
+    if (this->count_ >= this->max_count_ || this->data_.size() + len + 1 > this->max_bytes_) {
+        return false;
+    }
+    // Within the reserved capacity insert() moves the tail in place
+    this->data_.insert(pos, 1, '\0');
+    this->data_.insert(pos, tag, len);
+    this->count_++;
+    return true;
+}
+
+bool FilterList::remove(const char *tag, size_t len) {
+    bool found;
+    size_t pos = this->find_(tag, len, &found);
+    if (!found) {
+        return false;
+    }
+    this->data_.erase(pos, len + 1);
+    this->count_--;
+    return true;
+}
+
+bool FilterList::contains(const char *tag, size_t len) const {
+    bool found;
+    this->find_(tag, len, &found);
+    return found;
+}
+
+void FilterList::clear() {
+    // Keeps the capacity
+    this->data_.clear();
+    this->count_ = 0;
+}
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,61 @@
+// components/syslog/filter_list.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief Sorted set of filter tags kept in one string
+ *
+ * Tags are stored back to back in sorted order, each followed by a NUL, so
+ * the whole list is a single block instead of one node per tag. Without
+ * reserve() the block grows as needed; after it, additions that would need
+ * more than the reserved bytes or tags fail and the list never reallocates.
+ */
+class FilterList {
+    public:
+        // Allocate room for count tags taking bytes in total (each tag costs its length plus one)
+        void reserve(size_t bytes, size_t count);
+
+        // Insert a tag; returns false if it doesn't fit (an existing tag is not an error)
+        bool add(const char *tag, size_t len);
+        // Returns false if the tag wasn't in the list
+        bool remove(const char *tag, size_t len);
+        bool contains(const char *tag, size_t len) const;
+        void clear();
+
+        size_t size() const { return this->count_; }
+        bool empty() const { return this->count_ == 0; }
+        size_t max_size() const { return this->max_count_; }
+        // Bytes held on the heap
+        size_t allocated_bytes() const { return this->data_.capacity(); }
+
+        // Call fn(tag, len) for every tag in sorted order
+        template<typename F> void for_each(F fn) const {
+            const char *data = this->data_.data();
+            size_t pos = 0;
+            while (pos < this->data_.size()) {
+                size_t len = strnlen_(data + pos, this->data_.size() - pos);
+                fn(data + pos, len);
+                pos += len + 1;
+            }
+        }
+
+    protected:
+        static size_t strnlen_(const char *str, size_t max);
+        // Offset of the tag, or of the first tag sorting after it; sets found if it is there
+        size_t find_(const char *tag, size_t len, bool *found) const;
+
+        std::string data_;                  // Tags in sorted order, each followed by a NUL
+        size_t count_ = 0;
+        size_t max_bytes_ = SIZE_MAX;       // Limits set by reserve()
+        size_t max_count_ = SIZE_MAX;
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,99 @@
+// components/syslog/message_queue.cpp
+
+#include "message_queue.h"
+
+#include <cstring>
+#include <new>
+
+namespace esphome {
+namespace syslog {
+
+bool MessageQueue::init(size_t capacity, size_t slot_size) {
+    if (this->is_initialized()) {
+        return true;
+    }
+    if (capacity == 0 || slot_size == 0 || slot_size > UINT16_MAX) {
+        return false;
+    }
+
+    this->storage_.reset(new (std::nothrow) char[capacity * slot_size]);
+    this->lengths_.reset(new (std::nothrow) uint16_t[capacity]);
+    this->destinations_.reset(new (std::nothrow) uint8_t[capacity]);
+    this->times_.reset(new (std::nothrow) uint32_t[capacity]);
+    if (!this->storage_ || !this->lengths_ || !this->destinations_ || !this->times_) {
+        this->storage_.reset();
+        this->lengths_.reset();
+        this->destinations_.reset();
+        this->times_.reset();
+        return false;
+    }
+
+    this->capacity_ = capacity;
+    this->slot_size_ = slot_size;
+    this->clear();
+    return true;
+}
+
+bool MessageQueue::push(const char *data, size_t len, uint8_t destinations, uint32_t queued_us, DropPolicy policy) {
+    if (!this->is_initialized()) {
+        return false;
+    }
+
+    if (this->count_ == this->capacity_) {
+        this->dropped_++;
+        if (policy == DropPolicy::DROP_NEWEST) {
+            return false;
+        }
+        // Drop the oldest message to make room
+        this->pop();
+    }
+
+    // Messages longer than a slot are truncated
+    if (len > this->slot_size_) {
+        len = this->slot_size_;
+    }
+
+    size_t index = (this->head_ + this->count_) % this->capacity_;
+    memcpy(&this->storage_[index * this->slot_size_], data, len);
+    this->lengths_[index] = static_cast<uint16_t>(len);
+    this->destinations_[index] = destinations;
+    this->times_[index] = queued_us;
+    this->count_++;
+    if (this->count_ > this->high_water_) {
+        this->high_water_ = this->count_;
+    }
+    return true;
+}
+
+bool MessageQueue::peek(size_t index, const char **data, size_t *len, uint8_t *destinations) const {
+    if (index >= this->count_) {
+        return false;
+    }
+    size_t slot = (this->head_ + index) % this->capacity_;
+    *data = &this->storage_[slot * this->slot_size_];
+    *len = this->lengths_[slot];
+    *destinations = this->destinations_[slot];
+    return true;
+}
+
+void MessageQueue::set_destinations(size_t index, uint8_t destinations) {
+    if (index < this->count_) {
+        this->destinations_[(this->head_ + index) % this->capacity_] = destinations;
+    }
+}
+
+void MessageQueue::pop() {
+    if (this->count_ == 0) {
+        return;
+    }
+    this->head_ = (this->head_ + 1) % this->capacity_;
+    this->count_--;
+}
+
+void MessageQueue::clear() {
+    this->head_ = 0;
+    this->count_ = 0;
+}
+
+}  // namespace syslog
+}  // namespace esphome
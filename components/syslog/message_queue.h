@@ -0,0 +1,77 @@
+// components/syslog/message_queue.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief What to do with a new message when the send queue is full
+ */
+enum class DropPolicy {
+    DROP_OLDEST,    // Overwrite the oldest queued message
+    DROP_NEWEST     // Discard the incoming message
+};
+
+/**
+ * @brief Bounded ring buffer of preformatted syslog datagrams
+ *
+ * Storage is allocated once by init(); push() and pop() never touch the heap.
+ * Each slot holds one datagram of at most slot_size() bytes, plus the bit mask
+ * of the destinations it is sent to and the time it was queued.
+ */
+class MessageQueue {
+    public:
+        // Allocate capacity slots of slot_size bytes each (only the first call allocates)
+        bool init(size_t capacity, size_t slot_size);
+        bool is_initialized() const { return this->storage_ != nullptr; }
+
+        // Copy a datagram into the queue, applying the drop policy when full.
+        // Returns false if the message itself was dropped.
+        bool push(const char *data, size_t len, uint8_t destinations, uint32_t queued_us, DropPolicy policy);
+
+        // Peek at the oldest datagram; returns false if the queue is empty
+        bool front(const char **data, size_t *len, uint8_t *destinations) const {
+            return this->peek(0, data, len, destinations);
+        }
+        // Peek at the datagram index places behind the oldest one; returns false if there is none
+        bool peek(size_t index, const char **data, size_t *len, uint8_t *destinations) const;
+        // micros() when the datagram index places behind the oldest one was pushed
+        uint32_t queued_at(size_t index) const { return this->times_[(this->head_ + index) % this->capacity_]; }
+        // Replace the destination mask of the datagram index places behind the oldest one, for one
+        // that was only partly sent
+        void set_destinations(size_t index, uint8_t destinations);
+        void pop();
+        void clear();
+
+        bool empty() const { return this->count_ == 0; }
+        size_t size() const { return this->count_; }
+        size_t capacity() const { return this->capacity_; }
+        size_t slot_size() const { return this->slot_size_; }
+        uint32_t get_dropped_count() const { return this->dropped_; }
+        // Highest number of messages queued at once
+        size_t get_high_water() const { return this->high_water_; }
+        // Bytes allocated by init()
+        size_t allocated_bytes() const {
+            return this->capacity_ * (this->slot_size_ + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint32_t));
+        }
+
+    protected:
+        std::unique_ptr<char[]> storage_;       // capacity_ * slot_size_ bytes
+        std::unique_ptr<uint16_t[]> lengths_;   // Used length of each slot
+        std::unique_ptr<uint8_t[]> destinations_;  // Destination mask of each slot
+        std::unique_ptr<uint32_t[]> times_;     // micros() each slot was filled at
+        size_t capacity_ = 0;
+        size_t slot_size_ = 0;
+        size_t head_ = 0;                       // Index of the oldest message
+        size_t count_ = 0;                      // Number of queued messages
+        uint32_t dropped_ = 0;                  // Messages lost to the drop policy
+        size_t high_water_ = 0;                 // Maximum of count_
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,153 @@
+// components/syslog/outage_buffer.cpp
+
+#include "outage_buffer.h"
+
+#include <cstring>
+#include <new>
+
+namespace esphome {
+namespace syslog {
+
+static const size_t RECORD_HEADER_SIZE = 3;
+
+bool OutageBuffer::init(size_t capacity) {
+    if (this->is_initialized()) {
+        return true;
+    }
+    if (capacity <= RECORD_HEADER_SIZE) {
+        return false;
+    }
+
+    this->data_.reset(new (std::nothrow) uint8_t[capacity]);
+    if (!this->data_) {
+        return false;
+    }
+    this->capacity_ = capacity;
+    this->clear();
+    return true;
+}
+
+bool OutageBuffer::append(const char *data, size_t len, uint8_t destinations) {
+    if (!this->is_initialized()) {
+        return false;
+    }
+
+    // A record larger than the whole buffer can never be stored
+    size_t needed = RECORD_HEADER_SIZE + len;
+    if (needed > this->capacity_ || len > UINT16_MAX) {
+        this->lost_++;
+        return false;
+    }
+
+    while (this->capacity_ - this->used_ < needed) {
+        this->remove_oldest_();
+        this->lost_++;
+    }
+
+    uint8_t header[RECORD_HEADER_SIZE] = {static_cast<uint8_t>(len & 0xFF), static_cast<uint8_t>(len >> 8),
+                                          destinations};
+    this->write_(header, RECORD_HEADER_SIZE);
+    this->write_(reinterpret_cast<const uint8_t *>(data), len);
+    this->count_++;
+    return true;
+}
+
+size_t OutageBuffer::front(char *out, size_t out_capacity, uint8_t *destinations) const {
+    if (this->count_ == 0) {
+        return 0;
+    }
+
+    uint8_t header[RECORD_HEADER_SIZE];
+    this->read_(this->head_, header, RECORD_HEADER_SIZE);
+    size_t len = header[0] | (header[1] << 8);
+    *destinations = header[2];
+    size_t copy = len < out_capacity ? len : out_capacity;
+    this->read_((this->head_ + RECORD_HEADER_SIZE) % this->capacity_, reinterpret_cast<uint8_t *>(out), copy);
+    return copy;
+}
+
+void OutageBuffer::pop() {
+    if (this->count_ > 0) {
+        this->remove_oldest_();
+    }
+}
+
+size_t OutageBuffer::serialize(uint8_t *out, size_t out_capacity, uint32_t *omitted) const {
+    // Only whole records are written; the oldest are left out, the newest are closest to the incident
+    size_t offset = this->head_;
+    size_t bytes = this->used_;
+    uint32_t skipped = 0;
+    while (bytes > out_capacity) {
+        size_t record = RECORD_HEADER_SIZE + this->record_length_(offset);
+        offset = (offset + record) % this->capacity_;
+        bytes -= record;
+        skipped++;
+    }
+    // Records are stored back to back, so the rest is one contiguous (possibly wrapping) run
+    if (bytes > 0) {
+        this->read_(offset, out, bytes);
+    }
+    *omitted = skipped;
+    return bytes;
+}
+
+void OutageBuffer::deserialize(const uint8_t *data, size_t len) {
+    size_t pos = 0;
+    while (pos + RECORD_HEADER_SIZE <= len) {
+        size_t record_len = data[pos] | (data[pos + 1] << 8);
+        if (pos + RECORD_HEADER_SIZE + record_len > len) {
+            break;  // Truncated record
+        }
+        this->append(reinterpret_cast<const char *>(data + pos + RECORD_HEADER_SIZE), record_len, data[pos + 2]);
+        pos += RECORD_HEADER_SIZE + record_len;
+    }
+}
+
+void OutageBuffer::clear() {
+    this->head_ = 0;
+    this->used_ = 0;
+    this->count_ = 0;
+}
+
+void OutageBuffer::release() {
+    this->data_.reset();
+    this->capacity_ = 0;
+    this->lost_ = 0;
+    this->clear();
+}
+
+void OutageBuffer::write_(const uint8_t *src, size_t len) {
+    size_t tail = (this->head_ + this->used_) % this->capacity_;
+    size_t first = this->capacity_ - tail;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&this->data_[tail], src, first);
+    memcpy(&this->data_[0], src + first, len - first);
+    this->used_ += len;
+}
+
+void OutageBuffer::read_(size_t offset, uint8_t *dst, size_t len) const {
+    size_t first = this->capacity_ - offset;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(dst, &this->data_[offset], first);
+    memcpy(dst + first, &this->data_[0], len - first);
+}
+
+uint16_t OutageBuffer::record_length_(size_t offset) const {
+    uint8_t header[RECORD_HEADER_SIZE];
+    this->read_(offset, header, RECORD_HEADER_SIZE);
+    return header[0] | (header[1] << 8);
+}
+
+void OutageBuffer::remove_oldest_() {
+    size_t record = RECORD_HEADER_SIZE + this->record_length_(this->head_);
+    this->head_ = (this->head_ + record) % this->capacity_;
+    this->used_ -= record;
+    this->count_--;
+}
+
+}  // namespace syslog
+}  // namespace esphome
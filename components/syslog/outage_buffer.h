@@ -0,0 +1,75 @@
+// components/syslog/outage_buffer.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief Byte-budgeted FIFO of formatted datagrams kept while the network is down
+ *
+ * Records are stored back to back in a ring as
+ * [length (2 bytes, little endian)][destination mask (1 byte)][data], so short
+ * messages only cost their own size plus three bytes. When a new record doesn't
+ * fit, the oldest records are discarded and counted as lost.
+ */
+class OutageBuffer {
+    public:
+        // Allocate the ring (only the first call allocates)
+        bool init(size_t capacity);
+        bool is_initialized() const { return this->data_ != nullptr; }
+
+        // Append a datagram, discarding the oldest records if needed
+        bool append(const char *data, size_t len, uint8_t destinations);
+
+        // Copy the oldest datagram into out; returns its length (0 if empty)
+        size_t front(char *out, size_t out_capacity, uint8_t *destinations) const;
+        // Remove the oldest datagram
+        void pop();
+
+        // Copy the newest records that fit, oldest first, into out in their stored format; returns bytes
+        // written, and omitted gets the number of older records that didn't fit
+        size_t serialize(uint8_t *out, size_t out_capacity, uint32_t *omitted) const;
+        // Append records previously written by serialize()
+        void deserialize(const uint8_t *data, size_t len);
+
+        void clear();
+        // Free the ring; init() can allocate it again
+        void release();
+
+        bool empty() const { return this->count_ == 0; }
+        size_t size() const { return this->count_; }
+        size_t used_bytes() const { return this->used_; }
+        size_t capacity() const { return this->capacity_; }
+        // Bytes allocated by init(), 0 once released
+        size_t allocated_bytes() const { return this->data_ ? this->capacity_ : 0; }
+
+        // Messages discarded since the last take_lost_count()
+        uint32_t get_lost_count() const { return this->lost_; }
+        uint32_t take_lost_count() {
+            uint32_t lost = this->lost_;
+            this->lost_ = 0;
+            return lost;
+        }
+        void add_lost_count(uint32_t lost) { this->lost_ += lost; }
+
+    protected:
+        void write_(const uint8_t *src, size_t len);
+        void read_(size_t offset, uint8_t *dst, size_t len) const;
+        uint16_t record_length_(size_t offset) const;
+        void remove_oldest_();
+
+        std::unique_ptr<uint8_t[]> data_;
+        size_t capacity_ = 0;
+        size_t head_ = 0;       // Offset of the oldest record
+        size_t used_ = 0;       // Bytes in use, including length headers
+        size_t count_ = 0;      // Number of records
+        uint32_t lost_ = 0;     // Records discarded because the buffer was full
+};
+
+}  // namespace syslog
+}  // namespace esphome
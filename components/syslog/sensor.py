@@ -0,0 +1,88 @@
+import esphome.config_validation as cv
+import esphome.codegen as cg
+from esphome.components import sensor
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+from . import SyslogComponent
+
+# Component dependencies
+DEPENDENCIES = ['syslog']
+
+CONF_SYSLOG_ID = "syslog_id"
+CONF_CAPTURED = "captured"
+CONF_FILTERED = "filtered"
+CONF_SENT = "sent"
+CONF_SEND_FAILURES = "send_failures"
+CONF_BYTES_SENT = "bytes_sent"
+CONF_DROPPED = "dropped"
+CONF_QUEUE_HIGH_WATER = "queue_high_water"
+CONF_LOG_TIME_TOTAL = "log_time_total"
+CONF_LOG_TIME_MAX = "log_time_max"
+CONF_URGENT_DROPPED = "urgent_dropped"
+CONF_URGENT_LATENCY_AVG = "urgent_latency_avg"
+CONF_URGENT_LATENCY_MAX = "urgent_latency_max"
+CONF_BULK_DROPPED = "bulk_dropped"
+CONF_BULK_LATENCY_AVG = "bulk_latency_avg"
+CONF_BULK_LATENCY_MAX = "bulk_latency_max"
+
+UNIT_MESSAGES = "messages"
+UNIT_BYTES = "B"
+UNIT_MICROSECONDS = "µs"
+
+
+def counter_schema(unit, icon):
+    """Schema for a monotonically increasing diagnostic counter"""
+    return sensor.sensor_schema(
+        unit_of_measurement=unit,
+        icon=icon,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+def gauge_schema(unit, icon):
+    """Schema for a diagnostic value that can go up and down"""
+    return sensor.sensor_schema(
+        unit_of_measurement=unit,
+        icon=icon,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+# Sensor key -> (schema, setter name)
+SENSORS = {
+    CONF_CAPTURED: (counter_schema(UNIT_MESSAGES, "mdi:text-box-plus"), "set_captured_sensor"),
+    CONF_FILTERED: (counter_schema(UNIT_MESSAGES, "mdi:filter"), "set_filtered_sensor"),
+    CONF_SENT: (counter_schema(UNIT_MESSAGES, "mdi:send"), "set_sent_sensor"),
+    CONF_SEND_FAILURES: (counter_schema(UNIT_MESSAGES, "mdi:alert"), "set_send_failures_sensor"),
+    CONF_BYTES_SENT: (counter_schema(UNIT_BYTES, "mdi:upload-network"), "set_bytes_sent_sensor"),
+    CONF_DROPPED: (counter_schema(UNIT_MESSAGES, "mdi:delete-sweep"), "set_dropped_sensor"),
+    CONF_QUEUE_HIGH_WATER: (gauge_schema(UNIT_MESSAGES, "mdi:tray-full"), "set_queue_high_water_sensor"),
+    CONF_LOG_TIME_TOTAL: (counter_schema(UNIT_MICROSECONDS, "mdi:timer-outline"), "set_log_time_total_sensor"),
+    CONF_LOG_TIME_MAX: (gauge_schema(UNIT_MICROSECONDS, "mdi:timer-alert-outline"), "set_log_time_max_sensor"),
+    CONF_URGENT_DROPPED: (counter_schema(UNIT_MESSAGES, "mdi:delete-alert"), "set_urgent_dropped_sensor"),
+    CONF_URGENT_LATENCY_AVG: (gauge_schema(UNIT_MICROSECONDS, "mdi:timer-outline"), "set_urgent_latency_avg_sensor"),
+    CONF_URGENT_LATENCY_MAX: (gauge_schema(UNIT_MICROSECONDS, "mdi:timer-alert-outline"), "set_urgent_latency_max_sensor"),
+    CONF_BULK_DROPPED: (counter_schema(UNIT_MESSAGES, "mdi:delete-sweep"), "set_bulk_dropped_sensor"),
+    CONF_BULK_LATENCY_AVG: (gauge_schema(UNIT_MICROSECONDS, "mdi:timer-outline"), "set_bulk_latency_avg_sensor"),
+    CONF_BULK_LATENCY_MAX: (gauge_schema(UNIT_MICROSECONDS, "mdi:timer-alert-outline"), "set_bulk_latency_max_sensor"),
+}
+
+CONFIG_SCHEMA = cv.Schema({
+    cv.GenerateID(CONF_SYSLOG_ID): cv.use_id(SyslogComponent),
+    **{cv.Optional(key): schema for key, (schema, _) in SENSORS.items()},
+})
+
+def to_code(config):
+    """Attaches the configured statistics sensors to the syslog component"""
+    parent = yield cg.get_variable(config[CONF_SYSLOG_ID])
+    for key, (_, setter) in SENSORS.items():
+        if key in config:
+            sens = yield sensor.new_sensor(config[key])
+            cg.add(getattr(parent, setter)(sens))
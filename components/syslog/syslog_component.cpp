@@ -4,8 +4,14 @@
 
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/version.h"
-#include <algorithm>  // for std::transform
+#include "esphome/components/network/util.h"
+#include <algorithm>  // for std::replace, std::min
+#include <cctype>
+#include <cstdarg>
+#include <cstring>
+#include <new>
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -26,181 +32,1430 @@ static const char *TAG = "syslog";
 // https://github.com/esphome/esphome/blob/5c86f332b269fd3e4bffcbdf3359a021419effdd/esphome/core/log.h#L19-26
 static const uint8_t esphome_to_syslog_log_levels[] = {0, 3, 4, 6, 5, 7, 7, 7};
 
-// Helper function to trim whitespace
-static std::string trim(const std::string &str) {
-    size_t first = str.find_first_not_of(" \t\r\n");
-    if (first == std::string::npos)
-        return "";
-    size_t last = str.find_last_not_of(" \t\r\n");
-    return str.substr(first, (last - first + 1));
+// RFC 5424 NILVALUE, used for TIMESTAMP, MSGID and STRUCTURED-DATA when they are empty
+static const char SYSLOG_NILVALUE[] = "-";
+
+// Empty PROCID between APP-NAME and MSGID
+static const char SYSLOG_PROCID[] = " - ";
+
+// Separates STRUCTURED-DATA from the message, which starts with a UTF-8 BOM
+static const char SYSLOG_MSG_START[] = " \xEF\xBB\xBF";
+
+// Length of the header after the tag with a MSGID of msgid_len bytes and sd_len bytes of structured data
+static size_t trailer_length(size_t msgid_len, size_t sd_len) {
+    return sizeof(SYSLOG_PROCID) - 1 + msgid_len + 1 + sd_len + sizeof(SYSLOG_MSG_START) - 1;
+}
+
+// Appended to messages cut off at max_message_size
+static const char SYSLOG_TRUNCATION_MARKER[] = "...";
+
+// MSGID of a fragment: "<id>-<n>/<total>"
+static const char SYSLOG_FRAGMENT_MSGID_FORMAT[] = "%04x-%u/%u";
+
+// RFC 5424 section 7.3 "meta" SD-ID; sysUpTime is in hundredths of a second
+static const char SYSLOG_META_SEQUENCE_FORMAT[] = "[meta sequenceId=\"%u\"]";
+static const char SYSLOG_META_UPTIME_FORMAT[] = "[meta sysUpTime=\"%u\"]";
+static const char SYSLOG_META_BOTH_FORMAT[] = "[meta sequenceId=\"%u\" sysUpTime=\"%u\"]";
+
+// sequenceId runs from 1 to 2147483647 and then starts over at 1
+static const uint32_t SYSLOG_MAX_SEQUENCE_ID = 2147483647UL;
+
+// Helper function to append to a fixed-size buffer, truncating at capacity
+static size_t append_to_buffer(char *buf, size_t pos, size_t capacity, const char *src, size_t len) {
+    if (len == 0 || pos >= capacity) {
+        return pos;
+    }
+    size_t n = std::min(len, capacity - pos);
+    memcpy(buf + pos, src, n);
+    return pos + n;
+}
+
+// Whether len bytes of buf equal src (src may be null when len is 0)
+static bool bytes_equal(const char *buf, const char *src, size_t len) {
+    return len == 0 || memcmp(buf, src, len) == 0;
+}
+
+// Longest prefix of src that fits in max bytes without cutting a UTF-8 sequence in half
+static size_t utf8_prefix_length(const char *src, size_t len, size_t max) {
+    if (len <= max) {
+        return len;
+    }
+    size_t n = max;
+    while (n > 0 && (static_cast<uint8_t>(src[n]) & 0xC0) == 0x80) {
+        n--;
+    }
+    // Not UTF-8 after all, cut where asked
+    return n > 0 ? n : max;
+}
+
+// Number of decimal digits of value
+static size_t decimal_digits(size_t value) {
+    size_t digits = 1;
+    while (value >= 10) {
+        value /= 10;
+        digits++;
+    }
+    return digits;
+}
+
+// FNV-1a hash, used to detect repeated messages
+static const uint32_t FNV1A_OFFSET_BASIS = 2166136261UL;
+static uint32_t fnv1a_hash(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// Helper function to detect the component's own tag without building a string
+static bool is_syslog_tag(const char *tag, size_t len) {
+    return len == 6 && memcmp(tag, "syslog", 6) == 0;
+}
+
+/**
+ * @brief Counts a captured message and adds the time spent capturing it when it goes out of scope
+ *
+ * Messages the component logs while capturing another one (rate limit summaries,
+ * send warnings) are nested calls; their time is already part of the outer call,
+ * so only the outermost call is counted.
+ */
+class CaptureScope {
+    public:
+        CaptureScope(SyslogStats &stats, uint8_t &depth) : stats_(stats), depth_(depth), outer_(depth++ == 0) {
+            if (this->outer_) {
+                this->stats_.captured++;
+                this->start_ = micros();
+            }
+        }
+        ~CaptureScope() {
+            this->depth_--;
+            if (this->outer_) {
+                this->stats_.add_log_time(micros() - this->start_);
+            }
+        }
+
+    protected:
+        SyslogStats &stats_;
+        uint8_t &depth_;
+        bool outer_;
+        uint32_t start_ = 0;
+};
+
+// Helper function to trim whitespace: narrows [*start, *end) of str
+static void trim(const char *str, size_t *start, size_t *end) {
+    while (*start < *end && isspace(static_cast<unsigned char>(str[*start]))) {
+        (*start)++;
+    }
+    while (*end > *start && isspace(static_cast<unsigned char>(str[*end - 1]))) {
+        (*end)--;
+    }
+}
+
+// Whether a runtime setting of len bytes fits the capacity reserved for it; warns if it doesn't
+static bool fits_capacity(size_t len, size_t capacity, const char *what) {
+    if (len <= capacity) {
+        return true;
+    }
+    ESP_LOGW(TAG, "%s too long (%u bytes, room for %u), keeping the previous value", what, (unsigned) len,
+             (unsigned) capacity);
+    return false;
+}
+
+// Call fn(item, len) for every trimmed, non-empty item of a comma-separated list
+template<typename F> static void for_each_list_item(const std::string &list, F fn) {
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        size_t next = end + 1;
+        trim(list.data(), &start, &end);
+        if (end > start) {
+            fn(list.data() + start, end - start);
+        }
+        start = next;
+    }
+}
+
+SyslogComponent::SyslogComponent() {
+    // Components are constructed on the thread that later runs setup() and loop()
+#if defined(USE_ESP32)
+    this->loop_task_ = xTaskGetCurrentTaskHandle();
+#elif defined(USE_HOST)
+    this->loop_thread_ = pthread_self();
+#endif
+#ifdef USE_SYSLOG_STATIC_MEMORY
+    // Everything that can change at runtime gets its final capacity now, the setters
+    // only ever copy into it
+    this->settings_.address.reserve(SYSLOG_MAX_ADDRESS_LENGTH);
+    this->settings_.client_id.reserve(SYSLOG_MAX_CLIENT_ID_LENGTH);
+    this->hostname_field_.reserve(SYSLOG_MAX_CLIENT_ID_LENGTH + 2);
+    this->direct_log_prefix.reserve(SYSLOG_MAX_PREFIX_LENGTH);
+    this->logger_log_prefix.reserve(SYSLOG_MAX_PREFIX_LENGTH);
+    this->filter_string.reserve(SYSLOG_FILTER_STORAGE_SIZE);
+    // Stored tags are NUL-terminated; the trie needs a node per character plus the root
+    for (auto &filters : this->filter_sets_) {
+        filters.tags.reserve(SYSLOG_FILTER_STORAGE_SIZE + 1, SYSLOG_MAX_FILTERS);
+        filters.compiled.reserve(SYSLOG_FILTER_STORAGE_SIZE + 1);
+    }
+#endif
+    this->settings_.client_id.assign(App.get_name(), 0, SYSLOG_MAX_CLIENT_ID_LENGTH);
+    memset(this->tag_index_, 0xFF, sizeof(this->tag_index_));
+    this->active_filters_.store(&this->filter_sets_[0]);  // Empty, in exclude mode
+    this->strip_colors = true;
+    this->enable_logger = true;
+    this->enable_direct_logs = true;    // Enable direct logging by default
+    this->globally_enabled = true;      // Enable component by default
+    this->rebuild_headers_();
+#ifdef SYSLOG_MULTI_THREADED
+    // Other threads may log before setup(), so the ring exists as soon as the component does.
+    // Until setup() applies the configuration, every level is captured.
+    for (auto &level : this->capture_levels_) {
+        level.store(7, std::memory_order_relaxed);
+    }
+    this->capture_ring_.init(SYSLOG_CAPTURE_QUEUE_SIZE, SYSLOG_MAX_STRIPPED_SIZE);
+#endif
+}
+
+void SyslogComponent::setup() {
+#ifdef SYSLOG_MULTI_THREADED
+    this->update_capture_levels_();
+#endif
+
+    // If component is globally disabled, don't set up the socket
+    if (!this->globally_enabled) {
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Syslog component is disabled, skipping setup");
+        this->boot_.release();
+        return;
+    }
+
+    // Allocate the send queue once; reconfiguration keeps queued messages. The urgent lane's
+    // slots come on top of queue_size, which is all the bulk lane's.
+    MessageQueue &urgent = this->queues_[static_cast<size_t>(Lane::URGENT)];
+    MessageQueue &bulk = this->queues_[static_cast<size_t>(Lane::BULK)];
+    if ((this->urgent_queue_size_ > 0 && !urgent.init(this->urgent_queue_size_, SYSLOG_MAX_MESSAGE_SIZE)) ||
+        !bulk.init(this->queue_size_, SYSLOG_MAX_MESSAGE_SIZE)) {
+        ESP_LOGE(TAG, "Failed to allocate send queue (%u slots)", (unsigned) (this->queue_size_ + this->urgent_queue_size_));
+        this->boot_.release();
+        this->mark_failed();
+        return;
+    }
+
+    // Allocate the TCP frame buffer once, it holds at least one message of the largest size
+    if (this->transport_ == Transport::TCP &&
+        !this->tcp_.init(std::max(this->tcp_buffer_size_, SYSLOG_MAX_MESSAGE_SIZE + SYSLOG_TCP_FRAME_OVERHEAD))) {
+        ESP_LOGE(TAG, "Failed to allocate TCP buffer (%u bytes)", (unsigned) this->tcp_buffer_size_);
+        this->boot_.release();
+        this->mark_failed();
+        return;
+    }
+
+#ifdef SYSLOG_MULTI_THREADED
+    // The constructor allocates the capture ring; without it messages from other threads are dropped
+    if (!this->capture_ring_.is_initialized()) {
+        ESP_LOGW(TAG, "Failed to allocate capture ring (%u slots)", (unsigned) SYSLOG_CAPTURE_QUEUE_SIZE);
+    }
+#endif
+
+    // Allocate the outage buffer once, restoring what was kept over the last reboot
+    if (this->outage_buffer_size_ > 0 && !this->outage_.is_initialized()) {
+        if (!this->outage_.init(this->outage_buffer_size_)) {
+            ESP_LOGW(TAG, "Failed to allocate outage buffer (%u bytes)", (unsigned) this->outage_buffer_size_);
+        }
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        else {
+            this->load_outage_();
+        }
+#endif
+    }
+
+    // Resolve the destination address
+    if (!this->update_server_address_()) {
+        this->log_internal_(ESPHOME_LOG_LEVEL_ERROR, "Failed to parse server IP address '%s'",
+                            this->settings_.address.c_str());
+        this->boot_.release();
+        this->mark_failed();
+        return;
+    }
+    
+    // Create UDP socket
+    if (!this->ensure_socket_()) {
+        this->log_internal_(ESPHOME_LOG_LEVEL_ERROR, "Failed to create UDP socket");
+        this->boot_.release();
+        this->mark_failed();
+        return;
+    }
+    this->ensure_destination_sockets_();
+    this->update_tcp_address_();
+ 
+    // Log successful startup
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "------------------------ Syslog started ------------------------");
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Started with server: %s -> %u%s", this->settings_.address.c_str(),
+                        (unsigned) this->settings_.port, this->transport_ == Transport::TCP ? " (TCP)" : "");
+    for (const auto &dest : this->destinations_) {
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Additional server: %s -> %u", dest.address.c_str(),
+                            (unsigned) dest.port);
+    }
+    this->log_memory_usage_();
+    
+    // Set up logger callback if logger is available (already done if there is a boot buffer)
+    this->register_logger_callback_();
+    
+    // Publish statistics periodically (re-registering under the same name replaces the interval)
+    if (this->stats_interval_ms_ > 0) {
+        this->set_interval("stats", this->stats_interval_ms_, [this]() { this->publish_stats_(); });
+    }
+}
+
+// Whether the address is a literal IP rather than a hostname that needs a DNS lookup
+static bool is_ip_literal(const std::string &address) {
+    // IPv6 literals contain ':', hostnames never do
+    if (address.find(':') != std::string::npos) {
+        return true;
+    }
+    return !address.empty() && address.find_first_not_of("0123456789.") == std::string::npos;
+}
+
+// Format the IP of a sockaddr for log messages (inet_ntop isn't available with every socket implementation)
+static void format_address(const struct sockaddr_storage &address, char *out, size_t out_size) {
+    if (address.ss_family == AF_INET) {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&reinterpret_cast<const sockaddr_in *>(&address)->sin_addr);
+        snprintf(out, out_size, "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return;
+    }
+#if USE_NETWORK_IPV6
+    if (address.ss_family == AF_INET6) {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&reinterpret_cast<const sockaddr_in6 *>(&address)->sin6_addr);
+        size_t pos = 0;
+        for (int i = 0; i < 16 && pos < out_size; i += 2) {
+            pos += snprintf(out + pos, out_size - pos, i ? ":%x" : "%x", (bytes[i] << 8) | bytes[i + 1]);
+        }
+        return;
+    }
+#endif
+    snprintf(out, out_size, "?");
+}
+
+// Parse an address/port into a sockaddr; returns its length, 0 on failure
+static socklen_t parse_address(const std::string &address, uint16_t port, struct sockaddr_storage *server) {
+    socklen_t server_socklen = 0;
+    
+    // Use the version-appropriate method for socket address setup
+    if (ESPHOME_VERSION_CODE >= VERSION_CODE(2024, 8, 0)) {
+        // Use the new method for ESPHome 2024.8.0 and later
+        server_socklen = socket::set_sockaddr((struct sockaddr *)server, sizeof(*server), address, port);
+    }
+#if USE_NETWORK_IPV6
+    else if (address.find(':') != std::string::npos) {
+        // IPv6 address handling for older ESPHome versions
+        auto *server6 = reinterpret_cast<sockaddr_in6 *>(server);
+        memset(server6, 0, sizeof(*server6));
+        server6->sin6_family = AF_INET6;
+        server6->sin6_port = htons(port);
+
+        ip6_addr_t ip6;
+        inet6_aton(address.c_str(), &ip6);
+        memcpy(server6->sin6_addr.un.u32_addr, ip6.addr, sizeof(ip6.addr));
+        server_socklen = sizeof(*server6);
+    }
+#endif /* USE_NETWORK_IPV6 */
+    else {
+        // IPv4 address handling for older ESPHome versions
+        auto *server4 = reinterpret_cast<sockaddr_in *>(server);
+        memset(server4, 0, sizeof(*server4));
+        server4->sin_family = AF_INET;
+        server4->sin_addr.s_addr = inet_addr(address.c_str());
+        server4->sin_port = htons(port);
+        server_socklen = sizeof(*server4);
+    }
+    return server_socklen;
+}
+
+bool SyslogComponent::update_server_address_() {
+    // Hostnames are resolved from loop(), never here; until then messages wait in the queue
+    if (!is_ip_literal(this->settings_.address)) {
+        this->resolver_.set_host(this->settings_.address, this->settings_.port);
+        this->server_socklen = this->resolver_.get_address(&this->server);
+        if (!this->server_socklen) {
+            // Create the socket for the current (or default) family, it's replaced if the name resolves to another one
+            memset(&this->server, 0, sizeof(this->server));
+            this->server.ss_family = this->socket_family_ != AF_UNSPEC ? this->socket_family_ : AF_INET;
+        }
+        return true;
+    }
+    this->resolver_.clear();
+
+    struct sockaddr_storage server;
+    socklen_t server_socklen = parse_address(this->settings_.address, this->settings_.port, &server);
+    
+    // Keep the previous destination if the new one can't be parsed
+    if (!server_socklen) {
+        return false;
+    }
+    
+    this->server = server;
+    this->server_socklen = server_socklen;
+    return true;
+}
+
+bool SyslogComponent::ensure_socket_() {
+    // The UDP socket isn't bound to a destination, so it can be reused unless
+    // the address family changed (IPv4 <-> IPv6)
+    if (this->socket_ && this->socket_family_ == this->server.ss_family) {
+        return true;
+    }
+    
+    this->socket_ = socket::socket(this->server.ss_family, SOCK_DGRAM, IPPROTO_UDP);
+    this->socket_family_ = this->server.ss_family;
+    return this->socket_ != nullptr;
+}
+
+void SyslogComponent::poll_resolver_() {
+    if (!this->resolver_.is_active() || !network::is_connected()) {
+        return;
+    }
+    
+    DnsResolver::State before = this->resolver_.get_state();
+    if (this->resolver_.poll(millis())) {
+        this->server_socklen = this->resolver_.get_address(&this->server);
+        if (!this->ensure_socket_()) {
+            ESP_LOGE(TAG, "Failed to create UDP socket");
+        }
+        this->ensure_destination_sockets_();
+        this->update_tcp_address_();
+        
+        char ip[48];
+        format_address(this->server, ip, sizeof(ip));
+        ESP_LOGI(TAG, "Resolved %s to %s", this->resolver_.get_hostname().c_str(), ip);
+        // Queued messages waited for the address
+        this->high_freq_.start();
+    } else if (before != DnsResolver::State::FAILED && this->resolver_.get_state() == DnsResolver::State::FAILED) {
+        ESP_LOGW(TAG, "Failed to resolve %s, retrying", this->resolver_.get_hostname().c_str());
+    }
+}
+
+void SyslogComponent::update_tcp_address_() {
+    if (this->transport_ == Transport::TCP) {
+        this->tcp_.set_address(this->server, this->server_socklen);
+    }
+}
+
+void SyslogComponent::poll_tcp_() {
+    if (this->transport_ != Transport::TCP || !this->socket_ || !network::is_connected()) {
+        return;
+    }
+    
+    // Compared with the last poll, so failed writes in flush() are reported too
+    this->tcp_.loop(millis());
+    TcpTransport::State before = this->tcp_state_;
+    TcpTransport::State after = this->tcp_.get_state();
+    bool failed = this->tcp_.get_failure_count() != this->tcp_failures_;
+    this->tcp_state_ = after;
+    this->tcp_failures_ = this->tcp_.get_failure_count();
+    if (after == before && !failed) {
+        return;
+    }
+    
+    char ip[48];
+    format_address(this->server, ip, sizeof(ip));
+    if (after == TcpTransport::State::CONNECTED) {
+        ESP_LOGI(TAG, "Connected to %s over TCP", ip);
+        // Queued messages waited for the connection
+        this->high_freq_.start();
+    } else if (failed) {
+        ESP_LOGW(TAG, "TCP connection to %s %s, retrying in %us", ip,
+                 before == TcpTransport::State::CONNECTED ? "lost" : "failed",
+                 (unsigned) (this->tcp_.get_retry_delay() / 1000));
+    }
+}
+
+bool SyslogComponent::tcp_full_(size_t len, uint8_t destinations) const {
+    return this->transport_ == Transport::TCP && (destinations & SYSLOG_PRIMARY_DESTINATION) &&
+           !this->tcp_.can_frame(len);
+}
+
+bool SyslogComponent::can_send_() const {
+    return network::is_connected() && this->server_socklen != 0 &&
+           (this->transport_ != Transport::TCP || this->tcp_.is_connected());
+}
+
+uint8_t SyslogComponent::ready_destinations_() const {
+    // Additional destinations are literal addresses over UDP, only the primary server waits for
+    // its hostname or TCP connection
+    uint8_t ready = this->all_destinations_();
+    if (this->server_socklen == 0 || (this->transport_ == Transport::TCP && !this->tcp_.is_connected())) {
+        ready &= ~SYSLOG_PRIMARY_DESTINATION;
+    }
+    return ready;
+}
+
+void SyslogComponent::ensure_destination_sockets_() {
+    // Destinations of the same address family share the primary socket
+    for (auto &dest : this->destinations_) {
+        if (!dest.server_socklen || dest.server.ss_family == this->socket_family_) {
+            dest.socket.reset();
+        } else if (!dest.socket) {
+            dest.socket = socket::socket(dest.server.ss_family, SOCK_DGRAM, IPPROTO_UDP);
+            if (!dest.socket) {
+                ESP_LOGE(TAG, "Failed to create UDP socket for %s", dest.address.c_str());
+            }
+        }
+    }
+}
+
+void SyslogComponent::add_destination(const std::string &address, uint16_t port, int min_log_level,
+                                      bool include_mode, const std::vector<std::string> &filters) {
+    if (this->destinations_.size() + 1 >= SYSLOG_MAX_DESTINATIONS) {
+        ESP_LOGE(TAG, "Too many destinations, ignoring %s", address.c_str());
+        return;
+    }
+    
+    SyslogDestination dest;
+    dest.address = address;
+    dest.port = port;
+    dest.min_log_level = min_log_level;
+    dest.tag_filter = TagFilter::compile(filters, include_mode);
+    dest.server_socklen = parse_address(address, port, &dest.server);
+    if (!dest.server_socklen) {
+        ESP_LOGE(TAG, "Failed to parse destination address '%s'", address.c_str());
+    }
+    this->destinations_.push_back(std::move(dest));
+    
+    this->rebuild_level_masks_();
+    this->invalidate_tag_cache();
+}
+
+void SyslogComponent::set_min_log_level(int log_level) {
+    this->settings_.min_log_level = log_level;
+    this->rebuild_level_masks_();
+}
+
+void SyslogComponent::set_tag_levels(const TagLevels::Entry *table, size_t count) {
+    this->tag_levels_.set_table(table, count);
+    this->invalidate_tag_cache();
+}
+
+bool SyslogComponent::set_tag_level(const char *tag, int level) {
+    uint8_t clamped = static_cast<uint8_t>(std::max(0, std::min(level, 7)));
+    if (!this->tag_levels_.set_override(tag, clamped)) {
+        ESP_LOGW(TAG, "No room to override the level of '%s'", tag);
+        return false;
+    }
+    // Update the cached entries in place, their rate limit state stays
+    for (size_t i = 0; i < this->tag_cache_count_; i++) {
+        if (strcmp(this->tag_cache_[i].tag, tag) == 0) {
+            this->tag_cache_[i].min_level = static_cast<int8_t>(clamped);
+        }
+    }
+    ESP_LOGI(TAG, "Level for tag '%s' set to %d", tag, clamped);
+    return true;
+}
+
+void SyslogComponent::reset_tag_level(const char *tag) {
+    this->tag_levels_.clear_override(tag);
+    int level = this->tag_levels_.find(tag);
+    for (size_t i = 0; i < this->tag_cache_count_; i++) {
+        if (strcmp(this->tag_cache_[i].tag, tag) == 0) {
+            this->tag_cache_[i].min_level = static_cast<int8_t>(level);
+        }
+    }
+    ESP_LOGI(TAG, "Level for tag '%s' reset", tag);
+}
+
+void SyslogComponent::rebuild_level_masks_() {
+    for (int level = 0; level < 8; level++) {
+        uint8_t mask = level <= this->settings_.min_log_level ? SYSLOG_PRIMARY_DESTINATION : 0;
+        for (size_t i = 0; i < this->destinations_.size(); i++) {
+            if (level <= this->destinations_[i].min_log_level) {
+                mask |= 1u << (i + 1);
+            }
+        }
+        this->level_masks_[level] = mask;
+    }
+}
+
+void SyslogComponent::update_destination_() {
+    if (!this->update_server_address_()) {
+        this->log_internal_(ESPHOME_LOG_LEVEL_ERROR, "Failed to parse server IP address '%s', keeping previous destination",
+                            this->settings_.address.c_str());
+        return;
+    }
+    if (!this->ensure_socket_()) {
+        ESP_LOGE(TAG, "Failed to create UDP socket");
+    }
+    this->ensure_destination_sockets_();
+    this->update_tcp_address_();
+}
+
+bool SyslogComponent::is_loop_thread_() const {
+#if defined(USE_ESP32)
+    return xTaskGetCurrentTaskHandle() == this->loop_task_;
+#elif defined(USE_HOST)
+    return pthread_equal(pthread_self(), this->loop_thread_);
+#else
+    return true;
+#endif
+}
+
+void SyslogComponent::drain_capture_ring_() {
+    // At most one lap per loop(), so threads that keep logging can't hold up the loop
+    CaptureRing::Entry entry;
+    for (size_t i = 0; i < this->capture_ring_.capacity() && this->capture_ring_.front(&entry); i++) {
+        this->ring_captured_ms_ = entry.captured_ms;
+        this->from_capture_ring_ = true;
+        if (entry.tag != nullptr) {
+            this->on_logger_message_(entry.level, entry.tag, entry.text);
+        } else {
+            this->log(entry.level, entry.text, entry.tag_len, entry.text + entry.tag_len, entry.text_len,
+                      static_cast<LogSource>(entry.source));
+        }
+        this->from_capture_ring_ = false;
+        this->capture_ring_.pop();
+    }
+}
+
+void SyslogComponent::update_capture_levels_() {
+    int8_t logger = -1;
+    int8_t direct = -1;
+    int8_t internal = -1;
+    if (this->globally_enabled) {
+        internal = 7;
+        direct = this->enable_direct_logs ? 7 : -1;
+        if (this->enable_logger) {
+            logger = static_cast<int8_t>(this->tag_levels_.get_max_level());
+            for (int8_t level = 7; level > logger; level--) {
+                if (this->level_masks_[level] != 0) {
+                    logger = level;
+                }
+            }
+        }
+    }
+    this->capture_levels_[static_cast<size_t>(LogSource::LOGGER)].store(logger, std::memory_order_relaxed);
+    this->capture_levels_[static_cast<size_t>(LogSource::DIRECT)].store(direct, std::memory_order_relaxed);
+    this->capture_levels_[static_cast<size_t>(LogSource::INTERNAL)].store(internal, std::memory_order_relaxed);
+}
+
+uint32_t SyslogComponent::capture_millis_() const {
+    // Only the message taken from the ring, not what the component logs about itself while handling it
+    if (this->from_capture_ring_ && this->capture_depth_ <= 1) {
+        return this->ring_captured_ms_;
+    }
+    return millis();
+}
+
+void SyslogComponent::on_logger_message_(int level, const char *tag, const char *message) {
+#ifdef SYSLOG_MULTI_THREADED
+    // Other threads only copy the message; filtering, formatting and sending happen on the loop thread.
+    // A level nothing accepts doesn't take a slot, so a flood of verbose messages can't fill the ring.
+    if (level >= 0 && !this->is_loop_thread_()) {
+        int8_t max_level = this->capture_levels_[static_cast<size_t>(LogSource::LOGGER)].load(std::memory_order_relaxed);
+        if (std::min(level, 7) <= max_level) {
+            this->capture_ring_.push(static_cast<uint8_t>(level), static_cast<uint8_t>(LogSource::LOGGER), millis(),
+                                     tag, 0, true, message, strlen(message));
+        }
+        return;
+    }
+#endif
+
+    // Skip if component is disabled or no destination (and no per-tag level) takes this level
+    uint8_t level_index = std::min(static_cast<uint8_t>(level), static_cast<uint8_t>(7));
+    if (!this->globally_enabled || !this->enable_logger || this->is_failed() || level < 0 ||
+        (this->level_masks_[level_index] == 0 && level_index > this->tag_levels_.get_max_level()))
+        return;
+    
+    CaptureScope scope(this->stats_, this->capture_depth_);
+    
+    // Check which destinations the tag is filtered for; all verdicts come from the same cache entry
+    TagCacheEntry &entry = this->lookup_tag_(tag);
+    uint8_t level_mask = this->level_masks_[level_index];
+    if (entry.min_level >= 0) {
+        // The tag's own level replaces min_level for the primary server
+        level_mask &= ~SYSLOG_PRIMARY_DESTINATION;
+        if (level_index <= entry.min_level) {
+            level_mask |= SYSLOG_PRIMARY_DESTINATION;
+        }
+    }
+    uint8_t destinations = entry.destinations & level_mask;
+    if (destinations == 0) {
+        this->stats_.filtered++;
+        return;
+    }
+    
+    // Drop the message before formatting if the tag or the device is over its rate limit
+    if (!this->check_rate_limit_(tag, entry)) {
+        this->stats_.filtered++;
+        return;
+    }
+    
+    // While the send path is behind, only keep a sample of the low-severity levels
+    if (level_index >= ESPHOME_LOG_LEVEL_DEBUG && !this->sampler_.sample()) {
+        this->stats_.filtered++;
+        return;
+    }
+    
+    // Forward the log message, stripping color codes if configured
+    size_t message_len = strlen(message);
+    const char *payload = message;
+    if (this->strip_colors) {
+        message_len = strip_ansi(message, message_len, this->strip_buffer_, sizeof(this->strip_buffer_), &payload);
+    }
+    if (entry.prefixed) {
+        this->send_formatted_(level_index, destinations, this->logger_log_prefix.data(), this->logger_log_prefix.size(),
+                              tag, entry.tag_len, payload, message_len);
+    } else {
+        this->send_formatted_(level_index, destinations, nullptr, 0, tag, entry.tag_len, payload, message_len);
+    }
+}
+
+// Start slot of a tag pointer in the tag cache's index
+static size_t tag_index_slot(const char *tag) {
+    uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tag)) * 2654435761u;
+    return (hash >> 16) & (SYSLOG_TAG_INDEX_SIZE - 1);
+}
+
+SyslogComponent::TagCacheEntry &SyslogComponent::lookup_tag_(const char *tag) {
+    // Logger tags are static strings, so the pointer identifies the tag. The index has
+    // more slots than the cache has entries, so there is always a free slot to stop at.
+    size_t slot = tag_index_slot(tag);
+    while (this->tag_index_[slot] != 0xFF) {
+        TagCacheEntry &cached = this->tag_cache_[this->tag_index_[slot]];
+        if (cached.tag == tag) {
+            return cached;
+        }
+        slot = (slot + 1) & (SYSLOG_TAG_INDEX_SIZE - 1);
+    }
+    
+    // First message from this tag: evaluate the filters and the prefix once.
+    // Tags beyond the cache size use the scratch entry and are evaluated on every message;
+    // they share overflow_bucket_, which outlives the scratch entry.
+    TagCacheEntry *entry = &this->uncached_tag_;
+    if (this->tag_cache_count_ < SYSLOG_TAG_CACHE_SIZE) {
+        this->tag_index_[slot] = static_cast<uint8_t>(this->tag_cache_count_);
+        entry = &this->tag_cache_[this->tag_cache_count_++];
+        entry->bucket = TokenBucket();
+        entry->bucket.reset(this->get_effective_burst_(this->tag_rate_, this->tag_burst_), millis());
+    }
+    entry->tag = tag;
+    entry->tag_len = strlen(tag);
+    entry->destinations = this->filters_().compiled.should_send(tag) ? SYSLOG_PRIMARY_DESTINATION : 0;
+    for (size_t i = 0; i < this->destinations_.size(); i++) {
+        if (this->destinations_[i].tag_filter.should_send(tag)) {
+            entry->destinations |= 1u << (i + 1);
+        }
+    }
+    entry->min_level = static_cast<int8_t>(this->tag_levels_.find(tag));
+    entry->prefixed = !this->logger_log_prefix.empty() &&
+                      strncmp(tag, this->logger_log_prefix.c_str(), this->logger_log_prefix.size()) != 0;
+    return *entry;
+}
+
+void SyslogComponent::invalidate_tag_cache() {
+    // Rate limit state lives in the cache, report what it suppressed before dropping it
+    this->report_suppressed_(true);
+    this->tag_cache_count_ = 0;
+    memset(this->tag_index_, 0xFF, sizeof(this->tag_index_));
+    this->overflow_bucket_.reset(this->get_effective_burst_(this->tag_rate_, this->tag_burst_), millis());
+}
+
+bool SyslogComponent::check_rate_limit_(const char *tag, TagCacheEntry &entry) {
+    if (this->tag_rate_ <= 0 && this->global_rate_ <= 0) {
+        return true;
+    }
+    
+    // Only take the tag's token once the global limit lets the message through, so messages
+    // dropped by the global limit don't also use up the tag's share
+    uint32_t now = millis();
+    bool overflow = &entry == &this->uncached_tag_;
+    TokenBucket &bucket = overflow ? this->overflow_bucket_ : entry.bucket;
+    float tag_burst = this->get_effective_burst_(this->tag_rate_, this->tag_burst_);
+    if (!bucket.available(this->tag_rate_, tag_burst, now)) {
+        bucket.suppressed++;
+        return false;
+    }
+    if (!this->global_bucket_.consume(this->global_rate_,
+                                      this->get_effective_burst_(this->global_rate_, this->global_burst_), now)) {
+        this->global_bucket_.suppressed++;
+        return false;
+    }
+    bucket.consume(this->tag_rate_, tag_burst, now);
+    
+    // The tag is allowed again, summarize what was dropped before this message
+    if (bucket.suppressed > 0) {
+        uint32_t suppressed = bucket.suppressed;
+        bucket.suppressed = 0;
+        this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Suppressed %u messages from %s", (unsigned) suppressed,
+                            overflow ? "uncached tags" : tag);
+    }
+    return true;
+}
+
+void SyslogComponent::report_suppressed_(bool force) {
+    uint32_t now = millis();
+    float tag_burst = this->get_effective_burst_(this->tag_rate_, this->tag_burst_);
+    for (size_t i = 0; i < this->tag_cache_count_; i++) {
+        TokenBucket &bucket = this->tag_cache_[i].bucket;
+        if (bucket.suppressed == 0) {
+            continue;
+        }
+        // Only report once the bucket has a token again, i.e. the tag would be let through
+        bucket.refill(this->tag_rate_, tag_burst, now);
+        if (!force && this->tag_rate_ > 0 && bucket.tokens < 1.0f) {
+            continue;
+        }
+        uint32_t suppressed = bucket.suppressed;
+        bucket.suppressed = 0;
+        this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Suppressed %u messages from %s", (unsigned) suppressed,
+                            this->tag_cache_[i].tag);
+    }
+    
+    if (this->overflow_bucket_.suppressed > 0) {
+        this->overflow_bucket_.refill(this->tag_rate_, tag_burst, now);
+        if (force || this->tag_rate_ <= 0 || this->overflow_bucket_.tokens >= 1.0f) {
+            uint32_t suppressed = this->overflow_bucket_.suppressed;
+            this->overflow_bucket_.suppressed = 0;
+            this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Suppressed %u messages from uncached tags",
+                                (unsigned) suppressed);
+        }
+    }
+    
+    if (this->global_bucket_.suppressed > 0) {
+        this->global_bucket_.refill(this->global_rate_,
+                                    this->get_effective_burst_(this->global_rate_, this->global_burst_), now);
+        if (force || this->global_rate_ <= 0 || this->global_bucket_.tokens >= 1.0f) {
+            uint32_t suppressed = this->global_bucket_.suppressed;
+            this->global_bucket_.suppressed = 0;
+            this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Suppressed %u messages (global rate limit)",
+                                (unsigned) suppressed);
+        }
+    }
+}
+
+void SyslogComponent::set_tag_rate_limit(float rate, float burst) {
+    this->tag_rate_ = std::max(rate, 0.0f);
+    this->tag_burst_ = std::max(burst, 0.0f);
+    // Start every tag with a full bucket under the new limit
+    this->invalidate_tag_cache();
+}
+
+void SyslogComponent::set_global_rate_limit(float rate, float burst) {
+    this->report_suppressed_(true);
+    this->global_rate_ = std::max(rate, 0.0f);
+    this->global_burst_ = std::max(burst, 0.0f);
+    this->global_bucket_.reset(this->get_effective_burst_(this->global_rate_, this->global_burst_), millis());
+}
+
+void SyslogComponent::set_adaptive_sampling(uint16_t max_ratio, uint32_t report_interval_ms) {
+    // The ratio doubles and halves from 1, so the cap must be a power of two as well; round it down
+    while (max_ratio & (max_ratio - 1)) {
+        max_ratio &= max_ratio - 1;
+    }
+    this->sampling_max_ratio_ = max_ratio;
+    this->sampling_report_interval_ms_ = report_interval_ms;
+    if (this->sampler_.ratio > std::max(max_ratio, static_cast<uint16_t>(1))) {
+        this->report_sampling_();
+        this->sampler_.ratio = std::max(max_ratio, static_cast<uint16_t>(1));
+    }
+}
+
+void SyslogComponent::update_sampling_() {
+    // Backpressure: the bulk lane, where sampled messages go, filled up or dropped messages,
+    // or the network refused them
+    const MessageQueue &bulk = this->queues_[static_cast<size_t>(Lane::BULK)];
+    size_t capacity = std::max(bulk.capacity(), static_cast<size_t>(1));
+    bool dropped = bulk.get_dropped_count() != this->sampling_dropped_;
+    bool failed = this->stats_.send_failures != this->sampling_failures_;
+    size_t peak = this->sampling_peak_;
+    this->sampling_dropped_ = bulk.get_dropped_count();
+    this->sampling_failures_ = this->stats_.send_failures;
+    this->sampling_peak_ = bulk.size();
+    
+    uint16_t ratio = this->sampler_.ratio;
+    if (dropped || failed || peak * 4 >= capacity * 3) {
+        ratio = std::min(static_cast<uint16_t>(ratio * 2), this->sampling_max_ratio_);
+    } else if (peak * 4 < capacity && ratio > 1) {
+        ratio /= 2;
+    }
+    if (ratio == this->sampler_.ratio) {
+        return;
+    }
+    
+    // Summarize what the old ratio skipped once sampling stops
+    if (ratio == 1) {
+        this->report_sampling_();
+    }
+    this->sampler_.ratio = ratio;
+    this->sampler_.counter = 0;
+}
+
+void SyslogComponent::report_sampling_() {
+    this->last_sampling_report_ = millis();
+    if (this->sampler_.skipped == 0) {
+        return;
+    }
+    uint32_t skipped = this->sampler_.skipped;
+    this->sampler_.skipped = 0;
+    this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Sampling DEBUG and lower 1 in %u, skipped %u messages",
+                        (unsigned) this->sampler_.ratio, (unsigned) skipped);
+}
+
+void SyslogComponent::loop() {
+#ifdef SYSLOG_MULTI_THREADED
+    // The enable flags are public and may have been changed directly since the last loop
+    this->update_capture_levels_();
+    // Pick up messages logged from other threads first, they were captured before this loop
+    this->drain_capture_ring_();
+#endif
+
+    // Adapt the sampling ratio to the backlog and summarize what it skipped
+    if (this->sampling_max_ratio_ > 1) {
+        uint32_t now = millis();
+        if (now - this->last_sampling_adjust_ >= SYSLOG_SAMPLING_ADJUST_INTERVAL) {
+            this->last_sampling_adjust_ = now;
+            this->update_sampling_();
+        }
+        if (this->sampler_.skipped > 0 && now - this->last_sampling_report_ >= this->sampling_report_interval_ms_) {
+            this->report_sampling_();
+        }
+    }
+
+    // Summarize rate limited tags about once per second
+    if ((this->tag_rate_ > 0 || this->global_rate_ > 0) && millis() - this->last_suppressed_report_ >= 1000) {
+        this->last_suppressed_report_ = millis();
+        this->report_suppressed_(false);
+    }
+
+    // Summarize held back repeats once the window has passed
+    if (this->repeat_count_ > 0 && millis() - this->last_sent_time_ >= this->repeat_window_ms_) {
+        this->flush_repeats_();
+    }
+
+    // Resolve the server hostname, or refresh it once the TTL has run out
+    this->poll_resolver_();
+    
+    // Keep the TCP connection up, reconnecting with backoff
+    this->poll_tcp_();
+
+    // Messages logged before setup() are older than anything queued, send them first. While some
+    // are left, queued messages still move to the outage buffer, they just aren't sent yet.
+    bool boot_pending = false;
+    if (this->boot_.is_initialized() && this->socket_) {
+        this->flush_boot_buffer_();
+        boot_pending = this->boot_.is_initialized();
+    }
+
+    bool has_outage = this->outage_.is_initialized() && !this->outage_.empty();
+    if (this->queues_empty_() && !has_outage && !this->tcp_.has_pending()) {
+        this->high_freq_.stop();
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        this->save_outage_(false);
+#endif
+        return;
+    }
+
+    // Drop anything left over once the socket is gone (component disabled)
+    if (!this->socket_) {
+        for (auto &queue : this->queues_) {
+            queue.clear();
+        }
+        return;
+    }
+
+    const uint32_t start = micros();
+    const bool network_up = network::is_connected();
+    const uint8_t ready = this->ready_destinations_();
+    const bool can_send = network_up && ready == this->all_destinations_();
+    if (this->outage_.is_initialized() && (!network_up || ready == 0 || (has_outage && can_send))) {
+        // While the network is down or no destination is reachable, or older messages are still
+        // waiting in the outage buffer, move queued messages behind them so everything goes out in order
+        this->spill_queue_to_outage_();
+        if (can_send && !boot_pending) {
+            this->replay_buffer_(this->outage_, "during network outage", start);
+        }
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        this->save_outage_(false);
+#endif
+    } else if (ready == 0) {
+        // Keep messages queued until the hostname resolves or TCP connects, the drop policy applies meanwhile
+        this->high_freq_.stop();
+        return;
+    } else if (boot_pending) {
+        // Keep messages queued behind the boot buffer, the drop policy applies meanwhile
+        return;
+    } else {
+        // Drain queued messages in batches until the queue is empty or the time budget is used up.
+        // A destination that isn't ready (primary hostname unresolved, TCP connecting) doesn't hold up the others.
+        this->drain_queue_(start, ready);
+    }
+
+    // Everything framed for TCP in this loop goes out in one write
+    this->tcp_.flush();
+
+    // Report drops once the backlog has been cleared
+    if (this->queues_empty_()) {
+        static const char *const LANE_NAMES[SYSLOG_LANE_COUNT] = {"urgent", "bulk"};
+        for (size_t lane = 0; lane < SYSLOG_LANE_COUNT; lane++) {
+            uint32_t total = this->queues_[lane].get_dropped_count();
+            if (total != this->reported_dropped_[lane]) {
+                uint32_t dropped = total - this->reported_dropped_[lane];
+                this->reported_dropped_[lane] = total;
+                this->log_internal_(ESPHOME_LOG_LEVEL_WARN, "Send queue full (%s), dropped %u messages",
+                                    LANE_NAMES[lane], (unsigned) dropped);
+            }
+        }
+    }
+}
+
+void SyslogComponent::drain_queue_(uint32_t start, uint8_t ready) {
+    uint8_t failed[SYSLOG_SEND_BATCH];
+    uint8_t deferred[SYSLOG_SEND_BATCH];
+    while (!this->queues_empty_()) {
+        // Collect as many queued messages as the batch holds, for every destination; urgent
+        // messages first, and bulk ones only fill what is left
+        size_t count = 0;
+        size_t lane_counts[SYSLOG_LANE_COUNT] = {};
+        const char *data;
+        size_t len;
+        uint8_t destinations;
+        bool blocked = false;
+        for (size_t lane = 0; lane < SYSLOG_LANE_COUNT && !blocked; lane++) {
+            MessageQueue &queue = this->queues_[lane];
+            while (count < SYSLOG_SEND_BATCH && queue.peek(lane_counts[lane], &data, &len, &destinations)) {
+                uint8_t sendable = destinations & ready;
+                if (this->batch_.room() < static_cast<size_t>(__builtin_popcount(sendable))) {
+                    blocked = true;
+                    break;
+                }
+                // A full TCP buffer holds the queue back; it fills up and the drop policy decides
+                if (this->tcp_full_(len, sendable)) {
+                    this->tcp_.flush();
+                    if (this->tcp_full_(len, sendable)) {
+                        blocked = true;
+                        break;
+                    }
+                }
+                failed[count] = this->add_datagram_(count, data, len, sendable);
+                count++;
+                lane_counts[lane]++;
+            }
+        }
+        if (count == 0) {
+            break;
+        }
+        memset(deferred, 0, count);
+        this->send_batch_(failed, deferred);
+        
+        // Settle the whole batch before logging anything, a new message could overwrite queued ones
+        uint32_t now = micros();
+        size_t failed_len = 0;
+        bool kept = false;
+        bool requeued = false;
+        size_t i = 0;
+        for (size_t lane = 0; lane < SYSLOG_LANE_COUNT; lane++) {
+            MessageQueue &queue = this->queues_[lane];
+            size_t popped = 0;
+            for (size_t n = 0; n < lane_counts[lane]; n++, i++) {
+                queue.peek(n - popped, &data, &len, &destinations);
+                uint8_t sendable = destinations & ready;
+                if (requeued || deferred[i] != 0) {
+                    // The socket's send buffer is full: this message and the rest of the batch stay
+                    // queued for the next loop, for the destinations they haven't reached yet
+                    queue.set_destinations(n - popped, destinations & ~(sendable & ~deferred[i]));
+                    requeued = true;
+                    continue;
+                }
+                this->lane_stats_[lane].add_latency(now - queue.queued_at(0));
+                uint8_t unready = destinations & ~ready;
+                if (sendable != 0 && failed[i] == sendable && this->outage_.is_initialized()) {
+                    // Nothing went out, keep the message for replay instead of losing it
+                    this->outage_.append(data, len, destinations);
+                    this->outage_dirty_ = true;
+                    kept = true;
+                } else {
+                    if (failed[i]) {
+                        // After a partial failure the message isn't kept, replaying it would duplicate it elsewhere
+                        failed_len = len;
+                    } else if (sendable != 0) {
+                        this->send_failing_ = false;
+                    }
+                    // Destinations that weren't ready get the message from the outage buffer once they are
+                    if (unready != 0 && this->outage_.is_initialized()) {
+                        this->outage_.append(data, len, unready);
+                        this->outage_dirty_ = true;
+                    } else if (unready != 0) {
+                        this->stats_.unreachable += __builtin_popcount(unready);
+                    }
+                }
+                queue.pop();
+                popped++;
+            }
+        }
+        if (failed_len) {
+            this->warn_send_failure_(failed_len);
+        }
+        if (kept) {
+            // The rest waits behind it in the outage buffer
+            this->spill_queue_to_outage_();
+            break;
+        }
+        if (requeued) {
+            break;
+        }
+        
+        if (micros() - start >= this->max_loop_time_us_) {
+            break;
+        }
+    }
+}
+
+uint8_t SyslogComponent::send_datagram_(const char *data, size_t len, uint8_t destinations) {
+    uint8_t failed = this->add_datagram_(0, data, len, destinations);
+    this->send_batch_(&failed);
+    if (failed == 0) {
+        this->send_failing_ = false;
+    }
+    return failed;
+}
+
+uint8_t SyslogComponent::add_datagram_(uint8_t message, const char *data, size_t len, uint8_t destinations) {
+    uint8_t failed = 0;
+    for (size_t i = 0; i < SYSLOG_MAX_DESTINATIONS && (destinations >> i) != 0; i++) {
+        uint8_t bit = 1u << i;
+        if (!(destinations & bit)) {
+            continue;
+        }
+        
+        // The same formatted buffer goes to every destination; whatever uses the primary
+        // UDP socket is batched, the rest is handled right away
+        bool sent = false;
+        if (i == 0 && this->transport_ == Transport::TCP) {
+            // Framed for the next flush(), which does the actual write
+            sent = this->tcp_.is_connected() && this->tcp_.frame(data, len);
+        } else if (i == 0) {
+            if (this->server_socklen && this->batch_.add(data, len, &this->server, this->server_socklen, message, i)) {
+                continue;
+            }
+        } else if (i <= this->destinations_.size()) {
+            SyslogDestination &dest = this->destinations_[i - 1];
+            if (dest.server_socklen && dest.socket) {
+                this->stats_.send_calls++;
+                sent = dest.socket->sendto(data, len, 0, (struct sockaddr *)&dest.server, dest.server_socklen) >= 0;
+            } else if (dest.server_socklen && dest.server.ss_family == this->socket_family_ &&
+                       this->batch_.add(data, len, &dest.server, dest.server_socklen, message, i)) {
+                continue;
+            }
+        }
+        
+        if (!this->count_send_(sent, len)) {
+            failed |= bit;
+        }
+    }
+    return failed;
+}
+
+void SyslogComponent::send_batch_(uint8_t *failed, uint8_t *deferred) {
+    this->stats_.send_calls += this->batch_.send(this->socket_.get());
+    for (size_t i = 0; i < this->batch_.size(); i++) {
+        const DatagramBatch::Entry &entry = this->batch_[i];
+        if (entry.deferred && deferred != nullptr) {
+            deferred[entry.message] |= 1u << entry.destination;
+            continue;
+        }
+        if (!this->count_send_(entry.sent, entry.len)) {
+            failed[entry.message] |= 1u << entry.destination;
+        }
+    }
+    this->batch_.clear();
 }
 
-// Helper function to replace spaces with underscores
-static std::string replace_spaces_with_underscores(const std::string &str) {
-    std::string result = str;
-    std::replace(result.begin(), result.end(), ' ', '_');
-    return result;
+bool SyslogComponent::count_send_(bool sent, size_t len) {
+    if (!sent) {
+        this->stats_.send_failures++;
+        return false;
+    }
+    this->stats_.sent++;
+    this->stats_.bytes_sent += len;
+    return true;
 }
 
-// Helper function to ensure prefix ends with ": "
-static std::string normalize_prefix(const std::string &prefix) {
-    if (prefix.empty()) {
-        return prefix;
+void SyslogComponent::publish_stats_() {
+#ifdef USE_SENSOR
+    if (this->captured_sensor_ != nullptr)
+        this->captured_sensor_->publish_state(this->stats_.captured);
+    if (this->filtered_sensor_ != nullptr)
+        this->filtered_sensor_->publish_state(this->stats_.filtered);
+    if (this->sent_sensor_ != nullptr)
+        this->sent_sensor_->publish_state(this->stats_.sent);
+    if (this->send_failures_sensor_ != nullptr)
+        this->send_failures_sensor_->publish_state(this->stats_.send_failures);
+    if (this->bytes_sent_sensor_ != nullptr)
+        this->bytes_sent_sensor_->publish_state(this->stats_.bytes_sent);
+    if (this->dropped_sensor_ != nullptr)
+        this->dropped_sensor_->publish_state(this->get_total_dropped_count());
+    if (this->queue_high_water_sensor_ != nullptr)
+        this->queue_high_water_sensor_->publish_state(this->queue_high_water_);
+    if (this->log_time_total_sensor_ != nullptr)
+        this->log_time_total_sensor_->publish_state(this->stats_.log_time_us);
+    if (this->log_time_max_sensor_ != nullptr)
+        this->log_time_max_sensor_->publish_state(this->stats_.log_time_max_us);
+    for (size_t lane = 0; lane < SYSLOG_LANE_COUNT; lane++) {
+        if (this->lane_sensors_[lane].dropped != nullptr)
+            this->lane_sensors_[lane].dropped->publish_state(this->queues_[lane].get_dropped_count());
+        if (this->lane_sensors_[lane].latency_avg != nullptr)
+            this->lane_sensors_[lane].latency_avg->publish_state(this->lane_stats_[lane].average_latency_us());
+        if (this->lane_sensors_[lane].latency_max != nullptr)
+            this->lane_sensors_[lane].latency_max->publish_state(this->lane_stats_[lane].latency_max_us);
     }
-    
-    std::string result = trim(prefix);
-    
-    // Replace any spaces with underscores
-    result = replace_spaces_with_underscores(result);
-    
-    // Check if it ends with colon and space
-    if (result.size() >= 2 && result.substr(result.size() - 2) == ": ") {
-        return result;
+#endif
+
+    if (this->stats_report_) {
+        const LaneStats &urgent = this->lane_stats_[static_cast<size_t>(Lane::URGENT)];
+        const LaneStats &bulk = this->lane_stats_[static_cast<size_t>(Lane::BULK)];
+        char report[320];
+        int len = snprintf(report, sizeof(report),
+                     "Stats: captured=%u filtered=%u sent=%u failed=%u bytes=%llu calls=%u dropped=%u queue_max=%u/%u "
+                     "log_us_total=%llu log_us_max=%u urgent_dropped=%u urgent_wait_us=%u/%u "
+                     "bulk_dropped=%u bulk_wait_us=%u/%u",
+                     (unsigned) this->stats_.captured, (unsigned) this->stats_.filtered, (unsigned) this->stats_.sent,
+                     (unsigned) this->stats_.send_failures, (unsigned long long) this->stats_.bytes_sent,
+                     (unsigned) this->stats_.send_calls,
+                     (unsigned) this->get_total_dropped_count(), (unsigned) this->queue_high_water_,
+                     (unsigned) (this->queue_size_ + this->urgent_queue_size_), (unsigned long long) this->stats_.log_time_us,
+                     (unsigned) this->stats_.log_time_max_us,
+                     (unsigned) this->get_lane_dropped_count(Lane::URGENT), (unsigned) urgent.average_latency_us(),
+                     (unsigned) urgent.latency_max_us,
+                     (unsigned) this->get_lane_dropped_count(Lane::BULK), (unsigned) bulk.average_latency_us(),
+                     (unsigned) bulk.latency_max_us);
+        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, strlen(TAG), report,
+                  std::min(static_cast<size_t>(std::max(len, 0)), sizeof(report) - 1), LogSource::INTERNAL);
     }
-    
-    // Check if it ends with just a colon
-    if (!result.empty() && result.back() == ':') {
-        return result + " ";
+}
+
+void SyslogComponent::warn_send_failure_(size_t len) {
+    // Only warn once per failure streak, the warning itself ends up in the queue
+    if (!this->send_failing_) {
+        this->send_failing_ = true;
+        ESP_LOGW(TAG, "Failed to send syslog message (%u bytes)", (unsigned) len);
     }
-    
-    // Otherwise add the colon and space
-    return result + ": ";
 }
 
-SyslogComponent::SyslogComponent() {
-    this->settings_.client_id = App.get_name();
-    this->filter_include_mode = false; // Default to exclude mode
-    this->strip_colors = true;
-    this->enable_logger = true;
-    this->enable_direct_logs = true;    // Enable direct logging by default
-    this->globally_enabled = true;      // Enable component by default
-    this->filter_string = "";           // Initialize empty filter string
-    this->direct_log_prefix = "";       // Initialize empty direct log prefix
-    this->logger_log_prefix = "";       // Initialize empty logger log prefix
+void SyslogComponent::set_boot_buffer_size(size_t size) {
+    if (size == 0 || this->boot_.is_initialized() || this->socket_) {
+        return;
+    }
+    // Allocated up front so capturing during boot never allocates, and attached to the
+    // logger right away instead of at the end of setup()
+    if (!this->boot_.init(size)) {
+        ESP_LOGW(TAG, "Failed to allocate boot buffer (%u bytes)", (unsigned) size);
+        return;
+    }
+    this->register_logger_callback_();
 }
 
-void SyslogComponent::setup() {
-    // If component is globally disabled, don't set up the socket
-    if (!this->globally_enabled) {
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, "Syslog component is disabled, skipping setup", LogSource::INTERNAL);
+void SyslogComponent::flush_boot_buffer_() {
+    if (!this->can_send_()) {
         return;
     }
+    this->high_freq_.start();
+    this->replay_buffer_(this->boot_, "during boot", micros());
+    this->tcp_.flush();
+    
+    // Everything went out (including the lost-message line), the memory isn't needed anymore
+    if (this->boot_.empty() && this->boot_.get_lost_count() == 0) {
+        this->boot_.release();
+    }
+}
 
-    // Close existing socket if it exists
-    if (this->socket_) {
-        this->socket_.reset();
+void SyslogComponent::log_memory_usage_() {
+    // Buffers are allocated once and kept; the settings are the strings and lists that can
+    // still change (and, without static_memory, grow)
+    size_t settings = this->filter_string.capacity() + this->direct_log_prefix.capacity() +
+                      this->logger_log_prefix.capacity() + this->settings_.client_id.capacity() +
+                      this->hostname_field_.capacity() + this->settings_.address.capacity();
+    for (const auto &filters : this->filter_sets_) {
+        settings += filters.tags.allocated_bytes() + filters.compiled.allocated_bytes();
     }
+    size_t outage = this->outage_.allocated_bytes();
+#ifdef USE_SYSLOG_STATIC_MEMORY
+    const char *mode = "fixed";
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+    outage += this->outage_snapshot_ ? sizeof(OutageSnapshot) : 0;
+#endif
+#else
+    const char *mode = "can grow";
+#endif
+    ESP_LOGI(TAG, "Memory: component %u B, queue %u B, capture ring %u B, outage buffer %u B, boot buffer %u B, "
+             "TCP %u B, settings %u B (%s)",
+             (unsigned) sizeof(*this), (unsigned) (this->queues_[0].allocated_bytes() + this->queues_[1].allocated_bytes()),
+             (unsigned) this->capture_ring_.allocated_bytes(), (unsigned) outage,
+             (unsigned) this->boot_.allocated_bytes(), (unsigned) this->tcp_.allocated_bytes(), (unsigned) settings,
+             mode);
+}
 
-    // Set up the server address structure
-    this->server_socklen = 0;
-    
-    // Use the version-appropriate method for socket address setup
-    if (ESPHOME_VERSION_CODE >= VERSION_CODE(2024, 8, 0)) {
-        // Use the new method for ESPHome 2024.8.0 and later
-        this->server_socklen = socket::set_sockaddr((struct sockaddr *)&this->server, sizeof(this->server),
-                                                this->settings_.address, this->settings_.port);
+void SyslogComponent::register_logger_callback_() {
+    // setup() runs again when the component is re-enabled, so only register once;
+    // the callback itself checks enable_logger
+#ifdef USE_LOGGER
+    if (logger::global_logger != nullptr && !this->logger_callback_registered_) {
+        logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
+            this->on_logger_message_(level, tag, message);
+        });
+        this->logger_callback_registered_ = true;
     }
-#if USE_NETWORK_IPV6
-    else if (this->settings_.address.find(':') != std::string::npos) {
-        // IPv6 address handling for older ESPHome versions
-        auto *server6 = reinterpret_cast<sockaddr_in6 *>(&this->server);
-        memset(server6, 0, sizeof(*server6));
-        server6->sin6_family = AF_INET6;
-        server6->sin6_port = htons(this->settings_.port);
+#endif
+}
 
-        ip6_addr_t ip6;
-        inet6_aton(this->settings_.address.c_str(), &ip6);
-        memcpy(server6->sin6_addr.un.u32_addr, ip6.addr, sizeof(ip6.addr));
-        this->server_socklen = sizeof(*server6);
+void SyslogComponent::spill_queue_to_outage_() {
+    // The outage buffer is replayed as it is, so merge the lanes back into the order the messages
+    // were queued in; only the live queue lets urgent messages overtake
+    MessageQueue &urgent = this->queues_[static_cast<size_t>(Lane::URGENT)];
+    MessageQueue &bulk = this->queues_[static_cast<size_t>(Lane::BULK)];
+    const char *data;
+    size_t len;
+    uint8_t destinations;
+    for (;;) {
+        MessageQueue *queue = &bulk;
+        if (bulk.empty() || (!urgent.empty() && static_cast<int32_t>(urgent.queued_at(0) - bulk.queued_at(0)) <= 0)) {
+            queue = &urgent;
+        }
+        if (!queue->front(&data, &len, &destinations)) {
+            break;
+        }
+        this->outage_.append(data, len, destinations);
+        queue->pop();
+        this->outage_dirty_ = true;
     }
-#endif /* USE_NETWORK_IPV6 */
-    else {
-        // IPv4 address handling for older ESPHome versions
-        auto *server4 = reinterpret_cast<sockaddr_in *>(&this->server);
-        memset(server4, 0, sizeof(*server4));
-        server4->sin_family = AF_INET;
-        server4->sin_addr.s_addr = inet_addr(this->settings_.address.c_str());
-        server4->sin_port = htons(this->settings_.port);
-        this->server_socklen = sizeof(*server4);
+}
+
+void SyslogComponent::replay_buffer_(OutageBuffer &buffer, const char *lost_reason, uint32_t start) {
+    // Tell the receiver how many messages didn't fit before replaying the rest
+    uint32_t lost = buffer.get_lost_count();
+    if (lost > 0) {
+        char payload[64];
+        int payload_len = snprintf(payload, sizeof(payload), "%u messages lost %s", (unsigned) lost, lost_reason);
+        size_t len = this->format_(ESPHOME_LOG_LEVEL_WARN, nullptr, 0, TAG, strlen(TAG), payload,
+                                   std::min(static_cast<size_t>(std::max(payload_len, 0)), sizeof(payload) - 1));
+        uint8_t destinations = this->all_destinations_();
+        if (this->tcp_full_(len, destinations)) {
+            return;
+        }
+        if (this->send_datagram_(this->send_buffer_, len, destinations) == destinations) {
+            this->warn_send_failure_(len);
+            return;
+        }
+        this->stats_.outage_lost += buffer.take_lost_count();
+        this->outage_dirty_ |= &buffer == &this->outage_;
     }
     
-    // Check if we successfully set up the server address
-    if (!this->server_socklen) {
-        this->log(ESPHOME_LOG_LEVEL_ERROR, TAG, 
-                 "Failed to parse server IP address '" + this->settings_.address + "'", 
-                 LogSource::INTERNAL);
-        this->mark_failed();
+    // Replay a limited batch per loop so the backlog doesn't flood the network
+    for (size_t i = 0; i < SYSLOG_OUTAGE_REPLAY_BATCH && !buffer.empty(); i++) {
+        uint8_t destinations;
+        size_t len = buffer.front(this->send_buffer_, sizeof(this->send_buffer_), &destinations);
+        if (this->tcp_full_(len, destinations)) {
+            return;
+        }
+        uint8_t failed = this->send_datagram_(this->send_buffer_, len, destinations);
+        if (failed == destinations) {
+            this->warn_send_failure_(len);
+            return;
+        }
+        if (failed) {
+            this->warn_send_failure_(len);
+        }
+        buffer.pop();
+        this->outage_dirty_ |= &buffer == &this->outage_;
+        
+        if (micros() - start >= this->max_loop_time_us_) {
+            break;
+        }
+    }
+}
+
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+void SyslogComponent::load_outage_() {
+    // The key changed with the record format (destination mask), older snapshots are ignored
+    this->outage_pref_ = global_preferences->make_preference<OutageSnapshot>(fnv1_hash("syslog_outage_v2"), true);
+    
+#ifdef USE_SYSLOG_STATIC_MEMORY
+    // Allocated once and kept for save_outage_(), so saving never allocates
+    this->outage_snapshot_.reset(new (std::nothrow) OutageSnapshot());
+    OutageSnapshot *snapshot = this->outage_snapshot_.get();
+#else
+    // Heap allocated, the snapshot can be larger than the loop task's stack allows
+    std::unique_ptr<OutageSnapshot> temporary(new (std::nothrow) OutageSnapshot());
+    OutageSnapshot *snapshot = temporary.get();
+#endif
+    if (snapshot == nullptr || !this->outage_pref_.load(snapshot)) {
         return;
     }
     
-    // Create UDP socket
-    this->socket_ = socket::socket(this->server.ss_family, SOCK_DGRAM, IPPROTO_UDP);
-    if (!this->socket_) {
-        this->log(ESPHOME_LOG_LEVEL_ERROR, TAG, "Failed to create UDP socket", LogSource::INTERNAL);
-        this->mark_failed();
+    size_t length = std::min(static_cast<size_t>(snapshot->length), sizeof(snapshot->data));
+    this->outage_.deserialize(snapshot->data, length);
+    this->outage_.add_lost_count(snapshot->lost);
+    if (!this->outage_.empty()) {
+        ESP_LOGI(TAG, "Restored %u messages from before the last reboot", (unsigned) this->outage_.size());
+    }
+}
+
+void SyslogComponent::save_outage_(bool force) {
+    if (!this->outage_dirty_) {
+        return;
+    }
+    // Preferences are only written to flash on ESPHome's sync interval, this only limits the copying
+    if (!force && millis() - this->last_outage_save_ < SYSLOG_OUTAGE_SAVE_INTERVAL) {
         return;
     }
- 
-    // Log successful startup
-    this->log(ESPHOME_LOG_LEVEL_INFO, TAG, "------------------------ Syslog started ------------------------", LogSource::INTERNAL);
-    this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-              "Started with server: " + this->settings_.address + " -> " + std::to_string(this->settings_.port), 
-              LogSource::INTERNAL);
     
-    // Set up logger callback if logger is available
-    #ifdef USE_LOGGER
-    if (logger::global_logger != nullptr && this->enable_logger) {
-        logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
-            // Skip if component is disabled or level is filtered
-            if (!this->globally_enabled || (level > this->settings_.min_log_level)) 
-                return;
-            
-            // Check if tag is filtered
-            std::string tag_str(tag);
-            if (!this->should_send_log(tag_str)) {
-                return;
-            }
-            
-            // Forward the log message, stripping color codes if configured
-            if (this->strip_colors) {
-                // Strip the ESPHome color codes:
-                // 033[0;xxx at beginning and 033[0m at end
-                std::string org_msg(message);
-                if (org_msg.size() > 11) { // Ensure message is long enough to have color codes
-                    this->log(level, tag, org_msg.substr(7, org_msg.size() - 7 - 4), LogSource::LOGGER);
-                } else {
-                    // Message too short to have color codes, send as is
-                    this->log(level, tag, message, LogSource::LOGGER);
-                }
-            } else {
-                this->log(level, tag, message, LogSource::LOGGER);
-            }
-        });
+#ifdef USE_SYSLOG_STATIC_MEMORY
+    OutageSnapshot *snapshot = this->outage_snapshot_.get();
+#else
+    std::unique_ptr<OutageSnapshot> temporary(new (std::nothrow) OutageSnapshot());
+    OutageSnapshot *snapshot = temporary.get();
+#endif
+    if (snapshot == nullptr) {
+        return;
     }
-    #endif
+    // Records that don't fit in the snapshot are lost over a reboot, so they count towards the lost marker
+    uint32_t omitted = 0;
+    size_t length = this->outage_.serialize(snapshot->data, sizeof(snapshot->data), &omitted);
+    snapshot->length = static_cast<uint16_t>(length);
+    snapshot->lost = this->outage_.get_lost_count() + omitted;
+    this->outage_pref_.save(snapshot);
+    this->outage_dirty_ = false;
+    this->last_outage_save_ = millis();
 }
 
-void SyslogComponent::loop() {
-    // Currently nothing to do in loop
+void SyslogComponent::on_shutdown() {
+    this->spill_queue_to_outage_();
+    this->save_outage_(true);
 }
+#endif
 
-void SyslogComponent::set_server_ip(const std::string &address) {
-    if (this->settings_.address != address) {
-        // Store the new address
-        std::string old_address = this->settings_.address;
-        this->settings_.address = address;
+bool SyslogComponent::set_server_ip(const std::string &address) {
+    if (this->settings_.address == address) {
+        return true;
+    }
+    if (!fits_capacity(address.size(), SYSLOG_MAX_ADDRESS_LENGTH, "Server address")) {
+        return false;
+    }
+    
+    // Formatted before the address is replaced, it names both
+    char message[SYSLOG_INTERNAL_MESSAGE_SIZE];
+    snprintf(message, sizeof(message), "Syslog server IP updated: %s -> %s", this->settings_.address.c_str(),
+             address.c_str());
+    this->settings_.address.assign(address.data(), address.size());
+    
+    // Only update the destination if we're already set up
+    if (this->globally_enabled && this->is_setup()) {
+        // Point the existing socket at the new destination
+        this->update_destination_();
         
-        // Only attempt to recreate the socket if we're already set up
-        if (this->globally_enabled && this->is_setup()) {
-            // Recreate the socket with new address
-            this->setup();
-            
-            // Log the change
-            this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                     "Syslog server IP updated: " + old_address + " -> " + address, 
-                     LogSource::INTERNAL);
-        }
+        // Log the change
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "%s", message);
     }
+    return true;
 }
 
 void SyslogComponent::set_server_port(uint16_t port) {
@@ -209,56 +1464,46 @@ void SyslogComponent::set_server_port(uint16_t port) {
         uint16_t old_port = this->settings_.port;
         this->settings_.port = port;
         
-        // Only attempt to recreate the socket if we're already set up
+        // Only update the destination if we're already set up
         if (this->globally_enabled && this->is_setup()) {
-            // Recreate the socket with new port
-            this->setup();
+            // Point the existing socket at the new destination
+            this->update_destination_();
             
             // Log the change
-            this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                     "Syslog server port updated: " + std::to_string(old_port) + " -> " + 
-                     std::to_string(port),
-                     LogSource::INTERNAL);
+            this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Syslog server port updated: %u -> %u", (unsigned) old_port,
+                                (unsigned) port);
         }
     }
 }
 
 void SyslogComponent::set_enable_logger_messages(bool en) {
     if (this->enable_logger != en) { 
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                 "Logger messages: " + std::string(this->enable_logger ? "enabled" : "disabled") + 
-                 " -> " + std::string(en ? "enabled" : "disabled"),
-                 LogSource::INTERNAL);
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Logger messages: %s -> %s", this->enable_logger ? "enabled" : "disabled",
+                            en ? "enabled" : "disabled");
         this->enable_logger = en;
     }
 }
 
 void SyslogComponent::set_strip_colors(bool strip_colors) {
     if (this->strip_colors != strip_colors) {    
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                 "Strip colors: " + std::string(this->strip_colors ? "enabled" : "disabled") + 
-                 " -> " + std::string(strip_colors ? "enabled" : "disabled"),
-                 LogSource::INTERNAL);
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Strip colors: %s -> %s", this->strip_colors ? "enabled" : "disabled",
+                            strip_colors ? "enabled" : "disabled");
         this->strip_colors = strip_colors;
     }
 }
 
 void SyslogComponent::set_enable_direct_logs(bool en) {
     if (this->enable_direct_logs != en) {        
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                 "Direct logging: " + std::string(this->enable_direct_logs ? "enabled" : "disabled") + 
-                 " -> " + std::string(en ? "enabled" : "disabled"),
-                 LogSource::INTERNAL);
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Direct logging: %s -> %s", this->enable_direct_logs ? "enabled" : "disabled",
+                            en ? "enabled" : "disabled");
         this->enable_direct_logs = en;
     }
 }
 
 void SyslogComponent::set_globally_enabled(bool en) {
     if (this->globally_enabled != en) {
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                 "Syslog component: " + std::string(this->globally_enabled ? "enabled" : "disabled") + 
-                 " -> " + std::string(en ? "enabled" : "disabled"),
-                 LogSource::INTERNAL);
+        this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Syslog component: %s -> %s", this->globally_enabled ? "enabled" : "disabled",
+                            en ? "enabled" : "disabled");
         
         this->globally_enabled = en;
         
@@ -270,96 +1515,172 @@ void SyslogComponent::set_globally_enabled(bool en) {
             if (this->socket_) {
                 this->socket_.reset();
             }
+            this->tcp_.close();
+            for (auto &dest : this->destinations_) {
+                dest.socket.reset();
+            }
         }
     }
 }
 
-void SyslogComponent::add_filter(const std::string &tag) {
-    this->tag_filters.insert(tag);
-    this->log(ESPHOME_LOG_LEVEL_INFO, TAG, "Added filter for tag: '" + tag + "'", LogSource::INTERNAL);
+void SyslogComponent::set_filter_mode(bool include_mode) {
+    FilterSet &staged = this->stage_filters_();
+    staged.include_mode = include_mode;
+    this->publish_filters_(staged);
+}
+
+bool SyslogComponent::add_filter(const std::string &tag) {
+    FilterSet &staged = this->stage_filters_();
+    if (!staged.tags.add(tag.data(), tag.size()) || !this->publish_filters_(staged)) {
+        ESP_LOGW(TAG, "Filter list full (%u tags), ignoring '%s'", (unsigned) this->filters_().tags.size(),
+                 tag.c_str());
+        return false;
+    }
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Added filter for tag: '%s'", tag.c_str());
+    return true;
 }
 
 void SyslogComponent::remove_filter(const std::string &tag) {
-    this->tag_filters.erase(tag);
-    this->log(ESPHOME_LOG_LEVEL_INFO, TAG, "Removed filter for tag: '" + tag + "'", LogSource::INTERNAL);
+    FilterSet &staged = this->stage_filters_();
+    staged.tags.remove(tag.data(), tag.size());
+    this->publish_filters_(staged);
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Removed filter for tag: '%s'", tag.c_str());
 }
 
 void SyslogComponent::clear_filters() {
-    this->tag_filters.clear();
-    this->filter_string = "";
+    FilterSet &staged = this->stage_filters_();
+    staged.tags.clear();
+    this->publish_filters_(staged);
+    this->filter_string.clear();
     
     // Update text sensor if available
     if (this->filter_string_text_ != nullptr) {
-        this->filter_string_text_->publish_state("");
+        this->filter_string_text_->publish_state(this->filter_string);
     }
     
-    this->log(ESPHOME_LOG_LEVEL_INFO, TAG, "All filters cleared", LogSource::INTERNAL);
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "All filters cleared");
 }
 
-void SyslogComponent::set_client_id(const std::string &client_id) {
+bool SyslogComponent::set_client_id(const std::string &client_id) {
+    if (!fits_capacity(client_id.size(), SYSLOG_MAX_CLIENT_ID_LENGTH, "Client ID")) {
+        return false;
+    }
     // Replace spaces with underscores for client_id
-    this->settings_.client_id = replace_spaces_with_underscores(client_id);
+    this->settings_.client_id.assign(client_id.data(), client_id.size());
+    std::replace(this->settings_.client_id.begin(), this->settings_.client_id.end(), ' ', '_');
+    this->rebuild_headers_();
+    return true;
 }
 
-void SyslogComponent::set_direct_log_prefix(const std::string &prefix) {
-    this->direct_log_prefix = normalize_prefix(prefix);
+void SyslogComponent::set_facility(uint8_t facility) {
+    this->settings_.facility = std::min(facility, static_cast<uint8_t>(23));
+    this->rebuild_headers_();
 }
 
-void SyslogComponent::set_logger_log_prefix(const std::string &prefix) {
-    this->logger_log_prefix = normalize_prefix(prefix);
+void SyslogComponent::rebuild_headers_() {
+    // "<PRI>1 " and " client_id " only depend on the level, facility and client ID,
+    // so build them once instead of formatting them for every message
+    for (uint8_t level = 0; level < 8; level++) {
+        int pri = this->settings_.facility * 8 + esphome_to_syslog_log_levels[level];
+        char header[8];
+        int len = snprintf(header, sizeof(header), "<%d>1 ", pri);
+        this->level_headers_[level].assign(header, std::min(static_cast<size_t>(std::max(len, 0)), sizeof(header) - 1));
+    }
+    this->hostname_field_.assign(1, ' ');
+    this->hostname_field_.append(this->settings_.client_id);
+    this->hostname_field_.push_back(' ');
 }
 
-void SyslogComponent::set_filter_string(const std::string &filter_string) {
-    if (this->filter_string != filter_string) {
-        this->filter_string = filter_string;
-        
-        // Clear existing filters
-        this->tag_filters.clear();
-        
-        // Parse the new filter string (comma-separated list)
-        if (!filter_string.empty()) {
-            size_t start = 0;
-            size_t end = 0;
-            
-            while ((end = filter_string.find(',', start)) != std::string::npos) {
-                std::string item = trim(filter_string.substr(start, end - start));
-                
-                if (!item.empty()) {
-                    this->add_filter(item);
-                }
-                
-                start = end + 1;
-            }
-            
-            // Add the last item
-            std::string item = trim(filter_string.substr(start));
-            
-            if (!item.empty()) {
-                this->add_filter(item);
-            }
-        }
-        
-        // Update text sensor if available
-        if (this->filter_string_text_ != nullptr) {
-            this->filter_string_text_->publish_state(this->filter_string);
-        }
-        
-        this->log(ESPHOME_LOG_LEVEL_INFO, TAG, 
-                 "Filter string updated: '" + filter_string + "'", 
-                 LogSource::INTERNAL);
+bool SyslogComponent::assign_prefix_(std::string &out, const std::string &prefix, const char *what) {
+    // Trimmed, spaces replaced by underscores and ending with ": " (the trailing space was trimmed)
+    size_t start = 0;
+    size_t end = prefix.size();
+    trim(prefix.data(), &start, &end);
+    const char *separator = "";
+    if (end > start) {
+        separator = prefix[end - 1] == ':' ? " " : ": ";
+    }
+    if (!fits_capacity(end - start + strlen(separator), SYSLOG_MAX_PREFIX_LENGTH, what)) {
+        return false;
+    }
+    
+    out.assign(prefix.data() + start, end - start);
+    std::replace(out.begin(), out.end(), ' ', '_');
+    out.append(separator);
+    return true;
+}
+
+bool SyslogComponent::set_direct_log_prefix(const std::string &prefix) {
+    if (!this->assign_prefix_(this->direct_log_prefix, prefix, "Direct log prefix")) {
+        return false;
+    }
+    this->invalidate_tag_cache();
+    return true;
+}
+
+bool SyslogComponent::set_logger_log_prefix(const std::string &prefix) {
+    if (!this->assign_prefix_(this->logger_log_prefix, prefix, "Logger log prefix")) {
+        return false;
     }
+    this->invalidate_tag_cache();
+    return true;
+}
+
+bool SyslogComponent::set_filter_string(const std::string &filter_string) {
+    if (this->filter_string == filter_string) {
+        return true;
+    }
+    if (!fits_capacity(filter_string.size(), SYSLOG_FILTER_STORAGE_SIZE, "Filter string")) {
+        return false;
+    }
+    
+    // Build the new list next to the active one; if it doesn't fit, the active filters stay as they are
+    FilterSet &staged = this->stage_filters_();
+    staged.tags.clear();
+    size_t count = 0;
+    bool fits = true;
+    for_each_list_item(filter_string, [&](const char *item, size_t len) {
+        count++;
+        fits = staged.tags.add(item, len) && fits;
+    });
+    if (!fits) {
+        ESP_LOGW(TAG, "Filter string has %u tags, room for %u; keeping the previous filters", (unsigned) count,
+                 (unsigned) SYSLOG_MAX_FILTERS);
+        return false;
+    }
+    
+    // Count the differences before the swap, the previous set is reused by the next change
+    const FilterSet &previous = this->filters_();
+    unsigned added = 0;
+    unsigned removed = 0;
+    staged.tags.for_each([&](const char *tag, size_t len) { added += previous.tags.contains(tag, len) ? 0 : 1; });
+    previous.tags.for_each([&](const char *tag, size_t len) { removed += staged.tags.contains(tag, len) ? 0 : 1; });
+    if (!this->publish_filters_(staged)) {
+        ESP_LOGW(TAG, "Filter string '%s' doesn't fit; keeping the previous filters", filter_string.c_str());
+        return false;
+    }
+    this->filter_string.assign(filter_string.data(), filter_string.size());
+    
+    // Update text sensor if available
+    if (this->filter_string_text_ != nullptr) {
+        this->filter_string_text_->publish_state(this->filter_string);
+    }
+    
+    // One line for the whole change, however many tags it touched
+    this->log_internal_(ESPHOME_LOG_LEVEL_INFO, "Filter string updated: %u tags (%u added, %u removed) '%s'",
+                        (unsigned) this->filters_().tags.size(), added, removed, this->filter_string.c_str());
+    return true;
 }
 
 bool SyslogComponent::has_filter(const std::string &tag) const {
-    return this->tag_filters.find(tag) != this->tag_filters.end();
+    return this->filters_().tags.contains(tag.data(), tag.size());
 }
 
 std::vector<std::string> SyslogComponent::get_filters() const {
     std::vector<std::string> result;
-    result.reserve(this->tag_filters.size());  // Optimize by pre-allocating
-    for (const auto &tag : this->tag_filters) {
-        result.push_back(tag);
-    }
+    const FilterSet &filters = this->filters_();
+    result.reserve(filters.tags.size());  // Optimize by pre-allocating
+    filters.tags.for_each([&result](const char *tag, size_t len) { result.emplace_back(tag, len); });
     return result;
 }
 
@@ -372,50 +1693,46 @@ std::string SyslogComponent::extract_component_name(const std::string &tag) {
 }
 
 bool SyslogComponent::should_send_log(const std::string &tag) {
-    // Extract component name from tag (before the colon)
-    std::string component = extract_component_name(tag);
+    return this->filters_().compiled.should_send(tag.c_str());
+}
 
-    // Create a lower-case copy of the filter string for case-insensitive "all" check
-    std::string filter_lower = this->filter_string;
-    std::transform(filter_lower.begin(), filter_lower.end(), filter_lower.begin(), ::tolower);
+SyslogComponent::FilterSet &SyslogComponent::stage_filters_() {
+    // Filters are only read and changed on the loop thread (other threads just copy messages into
+    // the capture ring), so once a swap is done nothing still uses the set it replaced
+    const FilterSet &active = this->filters_();
+    FilterSet &staged = &active == &this->filter_sets_[0] ? this->filter_sets_[1] : this->filter_sets_[0];
+    // Copies into the staged set's own storage, which is reused from one change to the next
+    staged.tags = active.tags;
+    staged.include_mode = active.include_mode;
+    return staged;
+}
 
-    if (this->filter_include_mode) {
-        // In Include Mode:
-        // - "all" means include everything.
-        // - Empty filter means include nothing.
-        if (filter_lower == "all") {
-            return true;
-        }
-        if (this->filter_string.empty()) {
-            return false;
-        }
-        // Otherwise, include only if the component is in the filter list.
-        return this->has_filter(component);
-    } else {
-        // In Exclude Mode:
-        // - "all" means exclude everything.
-        // - Empty filter means include everything.
-        if (filter_lower == "all") {
-            return false;
-        }
-        if (this->filter_string.empty()) {
-            return true;
-        }
-        // Otherwise, exclude the log if the component is in the filter list.
-        return !this->has_filter(component);
+bool SyslogComponent::publish_filters_(FilterSet &staged) {
+    // Compile the whole list first; the per-message check only walks the trie
+    staged.compiled.clear(staged.include_mode);
+    bool fits = true;
+    staged.tags.for_each([&](const char *tag, size_t len) { fits = staged.compiled.add(tag, len) && fits; });
+    if (!fits) {
+        return false;
     }
+    staged.compiled.finish();
+    
+    // Readers see either the old set or the complete new one
+    this->active_filters_.store(&staged, std::memory_order_release);
+    this->invalidate_tag_cache();
+    return true;
 }
 
 LogSource SyslogComponent::get_message_source(const std::string &tag) const {
     // Check if tag starts with direct log prefix (if set)
     if (!this->direct_log_prefix.empty() && 
-        tag.substr(0, this->direct_log_prefix.length()) == this->direct_log_prefix) {
+        tag.compare(0, this->direct_log_prefix.length(), this->direct_log_prefix) == 0) {
         return LogSource::DIRECT;
     }
     
     // Check if tag starts with logger log prefix (if set)
     if (!this->logger_log_prefix.empty() && 
-        tag.substr(0, this->logger_log_prefix.length()) == this->logger_log_prefix) {
+        tag.compare(0, this->logger_log_prefix.length(), this->logger_log_prefix) == 0) {
         return LogSource::LOGGER;
     }
     
@@ -429,13 +1746,34 @@ LogSource SyslogComponent::get_message_source(const std::string &tag) const {
 }
 
 void SyslogComponent::log(uint8_t level, const std::string &tag, const std::string &payload, LogSource source) {
+    this->log(level, tag.c_str(), tag.size(), payload.c_str(), payload.size(), source);
+}
+
+void SyslogComponent::log(uint8_t level, const char *tag, size_t tag_len,
+                          const char *payload, size_t payload_len, LogSource source) {
+#ifdef SYSLOG_MULTI_THREADED
+    // Same as for logger messages, the tag is copied because it may not outlive the call. Direct
+    // messages aren't filtered by level, but nothing is captured while their source is disabled.
+    if (!this->is_loop_thread_()) {
+        LogSource gate = source == LogSource::DIRECT && is_syslog_tag(tag, tag_len) ? LogSource::INTERNAL : source;
+        int8_t max_level = this->capture_levels_[static_cast<size_t>(gate)].load(std::memory_order_relaxed);
+        if (std::min(level, static_cast<uint8_t>(7)) <= max_level) {
+            this->capture_ring_.push(level, static_cast<uint8_t>(source), millis(), tag, tag_len, false,
+                                     payload, payload_len);
+        }
+        return;
+    }
+#endif
+
     // Check if component is enabled
     if (!this->globally_enabled || this->is_failed()) {
         return;
     }
+    
+    CaptureScope scope(this->stats_, this->capture_depth_);
      
     // For direct log calls, check the enable_direct_logs flag
-    if (source == LogSource::DIRECT && !this->enable_direct_logs && tag != "syslog") {
+    if (source == LogSource::DIRECT && !this->enable_direct_logs && !is_syslog_tag(tag, tag_len)) {
         return;
     }
     
@@ -447,41 +1785,357 @@ void SyslogComponent::log(uint8_t level, const std::string &tag, const std::stri
     // Ensure level is valid
     level = std::min(level, static_cast<uint8_t>(7));
     
-    // Check if socket is available
+    // The primary server gets every direct and internal message, additional servers apply their min_level
+    uint8_t destinations = SYSLOG_PRIMARY_DESTINATION | this->level_masks_[level];
+
+    // Pick the source prefix if configured
+    const std::string *prefix = nullptr;
+    if (source == LogSource::DIRECT && !this->direct_log_prefix.empty()) {
+        prefix = &this->direct_log_prefix;
+    } else if (source == LogSource::LOGGER && !this->logger_log_prefix.empty()) {
+        prefix = &this->logger_log_prefix;
+    }
+
+    // Only add the prefix if it's not already there (avoids duplication on log actions)
+    if (prefix != nullptr && tag_len >= prefix->size() && memcmp(tag, prefix->data(), prefix->size()) == 0) {
+        prefix = nullptr;
+    }
+
+    if (prefix != nullptr) {
+        this->send_formatted_(level, destinations, prefix->data(), prefix->size(), tag, tag_len, payload, payload_len);
+    } else {
+        this->send_formatted_(level, destinations, nullptr, 0, tag, tag_len, payload, payload_len);
+    }
+}
+
+void SyslogComponent::log_internal_(uint8_t level, const char *format, ...) {
+    // Formatted on the stack, so reporting never allocates
+    char payload[SYSLOG_INTERNAL_MESSAGE_SIZE];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(payload, sizeof(payload), format, args);
+    va_end(args);
+    if (len < 0) {
+        return;
+    }
+    this->log(level, TAG, strlen(TAG), payload, std::min(static_cast<size_t>(len), sizeof(payload) - 1),
+              LogSource::INTERNAL);
+}
+
+void SyslogComponent::send_formatted_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                                      const char *tag, size_t tag_len, const char *payload, size_t payload_len) {
+    // Check if socket is available, keep the message for later if there is an outage buffer
     if (!this->socket_) {
-        ESP_LOGW(TAG, "Tried to send \"%s\"@\"%s\" with level %d but socket isn't connected", 
-                tag.c_str(), payload.c_str(), level);
+        if (this->boot_.is_initialized() || this->outage_.is_initialized()) {
+            this->format_and_queue_(level, destinations, prefix, prefix_len, tag, tag_len, payload, payload_len);
+            return;
+        }
+        ESP_LOGW(TAG, "Tried to send \"%.*s\"@\"%.*s\" with level %d but socket isn't connected",
+                (int) tag_len, tag, (int) payload_len, payload, level);
+        return;
+    }
+
+    // Hold back consecutive repeats of the same message
+    if (this->repeat_window_ms_ > 0 &&
+        this->is_repeat_(level, destinations, prefix, prefix_len, tag, tag_len, payload, payload_len)) {
+        this->stats_.filtered++;
         return;
     }
+
+    this->format_and_queue_(level, destinations, prefix, prefix_len, tag, tag_len, payload, payload_len);
+}
+
+void SyslogComponent::format_and_queue_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                                        const char *tag, size_t tag_len, const char *payload, size_t payload_len) {
+    size_t header_len = this->format_header_(level, prefix, prefix_len, tag, tag_len);
     
-    // Apply prefixes based on source if configured
-    std::string modified_tag = tag;
+    // Long messages go out as fragments if configured, otherwise they are truncated
+    bool oversized = header_len + trailer_length(1, this->structured_data_len_) + payload_len > sizeof(this->send_buffer_);
+    if (oversized && this->oversize_policy_ == OversizePolicy::SPLIT &&
+        this->queue_fragments_(level, header_len, destinations, payload, payload_len)) {
+        return;
+    }
     
-    // Add source prefix if configured
-    if (source == LogSource::DIRECT && !this->direct_log_prefix.empty()) {
-        // Only add the prefix if it's not already there (avoids duplication on log actions)
-        if (modified_tag.substr(0, this->direct_log_prefix.length()) != this->direct_log_prefix) {
-            modified_tag = this->direct_log_prefix + modified_tag;
+    size_t len = this->write_trailer_(header_len, SYSLOG_NILVALUE, 1);
+    if (oversized) {
+        // Leave room for the marker and don't cut a UTF-8 character in half
+        const size_t marker_len = sizeof(SYSLOG_TRUNCATION_MARKER) - 1;
+        size_t room = sizeof(this->send_buffer_) - std::min(len + marker_len, sizeof(this->send_buffer_));
+        len = append_to_buffer(this->send_buffer_, len, sizeof(this->send_buffer_), payload,
+                               utf8_prefix_length(payload, payload_len, room));
+        len = append_to_buffer(this->send_buffer_, len, sizeof(this->send_buffer_), SYSLOG_TRUNCATION_MARKER, marker_len);
+    } else {
+        len = append_to_buffer(this->send_buffer_, len, sizeof(this->send_buffer_), payload, payload_len);
+    }
+    this->enqueue_(level, len, destinations);
+}
+
+bool SyslogComponent::queue_fragments_(uint8_t level, size_t header_len, uint8_t destinations, const char *payload,
+                                       size_t payload_len) {
+    // The MSGID gets longer with the number of fragments, which in turn depends on the room
+    // it leaves; settle on a width that holds the resulting count
+    size_t total = 0;
+    size_t chunk = 0;
+    for (size_t digits = 1; digits <= 5; digits++) {
+        size_t msgid_len = 4 + 1 + digits + 1 + digits;
+        size_t used = header_len + trailer_length(msgid_len, this->structured_data_len_);
+        if (used + 16 > sizeof(this->send_buffer_)) {
+            // Fragments would hardly carry any text, truncate instead
+            return false;
         }
-    } else if (source == LogSource::LOGGER && !this->logger_log_prefix.empty()) {
-        // Only add the prefix if it's not already there
-        if (modified_tag.substr(0, this->logger_log_prefix.length()) != this->logger_log_prefix) {
-            modified_tag = this->logger_log_prefix + modified_tag;
+        chunk = sizeof(this->send_buffer_) - used;
+        total = 0;
+        for (size_t pos = 0; pos < payload_len; total++) {
+            pos += utf8_prefix_length(payload + pos, payload_len - pos, chunk);
         }
+        if (decimal_digits(total) <= digits) {
+            break;
+        }
+    }
+    if (!this->fragments_fit_(level, total)) {
+        // Queuing them would drop the message's own first fragments (or its tail), truncate instead
+        return false;
+    }
+    
+    // Every fragment reuses the header already in the send buffer, only the MSGID and text change
+    uint16_t id = ++this->fragment_id_;
+    size_t pos = 0;
+    for (size_t n = 1; n <= total; n++) {
+        char msgid[24];
+        int msgid_len = snprintf(msgid, sizeof(msgid), SYSLOG_FRAGMENT_MSGID_FORMAT, (unsigned) id, (unsigned) n,
+                                 (unsigned) total);
+        size_t len = this->write_trailer_(header_len, msgid,
+                                          std::min(static_cast<size_t>(std::max(msgid_len, 0)), sizeof(msgid) - 1));
+        size_t part = utf8_prefix_length(payload + pos, payload_len - pos, chunk);
+        len = append_to_buffer(this->send_buffer_, len, sizeof(this->send_buffer_), payload + pos, part);
+        pos += part;
+        this->enqueue_(level, len, destinations);
+    }
+    return true;
+}
+
+bool SyslogComponent::fragments_fit_(uint8_t level, size_t count) const {
+    if (!this->socket_) {
+        // Boot and outage buffers have a byte budget; a fragment takes at most a full datagram
+        const OutageBuffer &buffer = this->boot_.is_initialized() ? this->boot_ : this->outage_;
+        return count * sizeof(this->send_buffer_) <= buffer.capacity();
+    }
+    // drop_oldest makes room by dropping older messages, but only as long as there are any
+    const MessageQueue &queue = this->queues_[static_cast<size_t>(this->lane_for_level_(level))];
+    size_t slots = this->drop_policy_ == DropPolicy::DROP_OLDEST ? queue.capacity() : queue.capacity() - queue.size();
+    return count <= slots;
+}
+
+Lane SyslogComponent::lane_for_level_(uint8_t level) const {
+    // Without reserved slots everything shares the bulk lane
+    if (esphome_to_syslog_log_levels[std::min(level, static_cast<uint8_t>(7))] <= SYSLOG_URGENT_SEVERITY &&
+        this->queues_[static_cast<size_t>(Lane::URGENT)].is_initialized()) {
+        return Lane::URGENT;
+    }
+    return Lane::BULK;
+}
+
+void SyslogComponent::enqueue_(uint8_t level, size_t len, uint8_t destinations) {
+    // Without a socket (only called then if there is a boot or outage buffer) the message waits for replay
+    if (!this->socket_) {
+        if (this->boot_.is_initialized()) {
+            this->boot_.append(this->send_buffer_, len, destinations);
+        } else {
+            this->outage_.append(this->send_buffer_, len, destinations);
+            this->outage_dirty_ = true;
+        }
+        return;
+    }
+    
+    // Queue the message in its lane, loop() sends it
+    Lane lane = this->lane_for_level_(level);
+    MessageQueue &queue = this->queues_[static_cast<size_t>(lane)];
+    queue.push(this->send_buffer_, len, destinations, micros(), this->drop_policy_);
+    if (lane == Lane::BULK) {
+        this->sampling_peak_ = std::max(this->sampling_peak_, queue.size());
+    }
+    this->queue_high_water_ = std::max(this->queue_high_water_, this->queued_count_());
+    this->high_freq_.start();
+}
+
+size_t SyslogComponent::format_header_(uint8_t level, const char *prefix, size_t prefix_len,
+                                       const char *tag, size_t tag_len) {
+    // Format according to syslog protocol, straight into the send buffer
+    char *buf = this->send_buffer_;
+    const size_t capacity = sizeof(this->send_buffer_);
+    const std::string &header = this->level_headers_[level];
+    size_t len = append_to_buffer(buf, 0, capacity, header.data(), header.size());
+    
+    // Messages from the loop thread are formatted when they are captured; those from other threads
+    // carry the time they were pushed to the capture ring
+    uint32_t captured_ms = this->capture_millis_();
+    size_t timestamp_len = this->timestamps_ ? this->format_timestamp_(buf + len, capacity - len, captured_ms) : 0;
+    if (timestamp_len > 0) {
+        len += timestamp_len;
+    } else {
+        len = append_to_buffer(buf, len, capacity, SYSLOG_NILVALUE, 1);
+    }
+    
+    len = append_to_buffer(buf, len, capacity, this->hostname_field_.data(), this->hostname_field_.size());
+    len = append_to_buffer(buf, len, capacity, prefix, prefix_len);
+    len = append_to_buffer(buf, len, capacity, tag, tag_len);
+    
+    // Structured data goes after the MSGID, which differs between fragments; keep it aside until then
+    this->format_structured_data_(captured_ms);
+    return len;
+}
+
+void SyslogComponent::format_structured_data_(uint32_t captured_ms) {
+    int len = 0;
+    // Boot messages always carry their capture offset, they are sent long after it
+    bool uptime = this->timestamps_ || (!this->socket_ && this->boot_.is_initialized());
+    if (this->sequence_ids_) {
+        // Numbered at capture, so every message lost after this point shows up as a gap
+        this->sequence_id_ = this->sequence_id_ >= SYSLOG_MAX_SEQUENCE_ID ? 1 : this->sequence_id_ + 1;
+    }
+    if (this->sequence_ids_ && uptime) {
+        len = snprintf(this->structured_data_, sizeof(this->structured_data_), SYSLOG_META_BOTH_FORMAT,
+                       (unsigned) this->sequence_id_, (unsigned) (captured_ms / 10));
+    } else if (this->sequence_ids_) {
+        len = snprintf(this->structured_data_, sizeof(this->structured_data_), SYSLOG_META_SEQUENCE_FORMAT,
+                       (unsigned) this->sequence_id_);
+    } else if (uptime) {
+        len = snprintf(this->structured_data_, sizeof(this->structured_data_), SYSLOG_META_UPTIME_FORMAT,
+                       (unsigned) (captured_ms / 10));
+    }
+    
+    if (len <= 0) {
+        this->structured_data_[0] = SYSLOG_NILVALUE[0];
+        len = 1;
+    }
+    this->structured_data_len_ = std::min(static_cast<size_t>(len), sizeof(this->structured_data_) - 1);
+}
+
+size_t SyslogComponent::format_timestamp_(char *out, size_t size, uint32_t captured_ms) {
+#ifdef USE_TIME
+    if (this->time_ == nullptr) {
+        return 0;
+    }
+    
+    // Wall clock in ms is millis() plus an offset. The clock only has whole seconds, so each reading
+    // gives a lower bound of the offset; the largest one seen is the best estimate.
+    uint32_t now_ms = millis();
+    time_t epoch = this->time_->timestamp_now();
+    if (epoch < SYSLOG_MIN_VALID_EPOCH) {
+        return 0;
+    }
+    int64_t offset = static_cast<int64_t>(epoch) * 1000 - now_ms;
+    if (!this->clock_offset_valid_ || offset > this->clock_offset_ms_ || this->clock_offset_ms_ - offset >= 1000) {
+        // First reading, a better estimate, or the clock was set back (SNTP correction)
+        this->clock_offset_ms_ = offset;
+        this->clock_offset_valid_ = true;
+    }
+    
+    int64_t wall_ms = this->clock_offset_ms_ + captured_ms;
+    time_t seconds = static_cast<time_t>(wall_ms / 1000);
+    if (seconds != this->timestamp_second_) {
+        // "YYYY-MM-DDTHH:MM:SS" only changes once a second
+        ESPTime t = ESPTime::from_epoch_utc(seconds);
+        this->timestamp_cache_len_ = t.strftime(this->timestamp_cache_, sizeof(this->timestamp_cache_), "%Y-%m-%dT%H:%M:%S");
+        this->timestamp_second_ = seconds;
+    }
+    if (this->timestamp_cache_len_ == 0) {
+        return 0;
+    }
+    
+    int len = snprintf(out, size, "%.*s.%03uZ", (int) this->timestamp_cache_len_, this->timestamp_cache_,
+                       (unsigned) (wall_ms % 1000));
+    return len > 0 && static_cast<size_t>(len) < size ? len : 0;
+#else
+    return 0;
+#endif
+}
+
+size_t SyslogComponent::write_trailer_(size_t pos, const char *msgid, size_t msgid_len) {
+    char *buf = this->send_buffer_;
+    const size_t capacity = sizeof(this->send_buffer_);
+    pos = append_to_buffer(buf, pos, capacity, SYSLOG_PROCID, sizeof(SYSLOG_PROCID) - 1);
+    pos = append_to_buffer(buf, pos, capacity, msgid, msgid_len);
+    pos = append_to_buffer(buf, pos, capacity, " ", 1);
+    pos = append_to_buffer(buf, pos, capacity, this->structured_data_, this->structured_data_len_);
+    return append_to_buffer(buf, pos, capacity, SYSLOG_MSG_START, sizeof(SYSLOG_MSG_START) - 1);
+}
+
+size_t SyslogComponent::format_(uint8_t level, const char *prefix, size_t prefix_len,
+                                const char *tag, size_t tag_len, const char *payload, size_t payload_len) {
+    size_t len = this->format_header_(level, prefix, prefix_len, tag, tag_len);
+    len = this->write_trailer_(len, SYSLOG_NILVALUE, 1);
+    return append_to_buffer(this->send_buffer_, len, sizeof(this->send_buffer_), payload, payload_len);
+}
+
+bool SyslogComponent::is_repeat_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                                 const char *tag, size_t tag_len, const char *payload, size_t payload_len) {
+    uint32_t hash = fnv1a_hash(FNV1A_OFFSET_BASIS, &level, 1);
+    hash = fnv1a_hash(hash, &destinations, 1);
+    hash = fnv1a_hash(hash, prefix, prefix_len);
+    hash = fnv1a_hash(hash, tag, tag_len);
+    hash = fnv1a_hash(hash, "", 1);  // Separator, so tag/payload boundaries matter
+    hash = fnv1a_hash(hash, payload, payload_len);
+    
+    // The hash only picks the candidate, the kept text decides; a collision must not swallow a message
+    size_t key_len = prefix_len + tag_len + 1 + payload_len;
+    uint32_t now = millis();
+    if (hash == this->last_hash_ && now - this->last_sent_time_ < this->repeat_window_ms_ &&
+        level == this->last_level_ && destinations == this->last_destinations_ && key_len == this->last_key_len_ &&
+        bytes_equal(this->last_key_, prefix, prefix_len) &&
+        bytes_equal(this->last_key_ + prefix_len, tag, tag_len) &&
+        bytes_equal(this->last_key_ + prefix_len + tag_len + 1, payload, payload_len)) {
+        this->repeat_count_++;
+        return true;
+    }
+    
+    // A different message (or the window ran out): summarize the repeats first
+    this->flush_repeats_();
+    
+    this->last_hash_ = hash;
+    this->last_sent_time_ = now;
+    this->last_level_ = level;
+    this->last_destinations_ = destinations;
+    
+    // Messages too long to keep are never coalesced
+    if (key_len <= sizeof(this->last_key_)) {
+        size_t pos = append_to_buffer(this->last_key_, 0, key_len, prefix, prefix_len);
+        pos = append_to_buffer(this->last_key_, pos, key_len, tag, tag_len);
+        this->last_key_[pos++] = '\0';
+        append_to_buffer(this->last_key_, pos, key_len, payload, payload_len);
+        this->last_key_len_ = key_len;
+    } else {
+        this->last_key_len_ = 0;
+    }
+    size_t stored = append_to_buffer(this->last_tag_, 0, sizeof(this->last_tag_), prefix, prefix_len);
+    this->last_tag_len_ = append_to_buffer(this->last_tag_, stored, sizeof(this->last_tag_), tag, tag_len);
+    return false;
+}
+
+void SyslogComponent::flush_repeats_() {
+    if (this->repeat_count_ == 0) {
+        return;
     }
     
-    // Format according to syslog protocol
-    int pri = esphome_to_syslog_log_levels[level];
-    std::string buf = str_sprintf("<%d>1 - %s %s - - - \xEF\xBB\xBF%s",
-                                 pri, this->settings_.client_id.c_str(),
-                                 modified_tag.c_str(), payload.c_str());
+    char payload[48];
+    int payload_len = snprintf(payload, sizeof(payload), "last message repeated %u times",
+                               (unsigned) this->repeat_count_);
+    this->repeat_count_ = 0;
     
-    // Send the message
-    if (this->socket_->sendto(buf.c_str(), buf.length(), 0, 
-                              (struct sockaddr *)&this->server, this->server_socklen) < 0) {
-        ESP_LOGW(TAG, "Failed to send syslog message: \"%s\"@\"%s\"", 
-                modified_tag.c_str(), payload.c_str());
+    // The summary itself must not be coalesced, so bypass send_formatted_()
+    if (this->socket_ && payload_len > 0) {
+        this->format_and_queue_(this->last_level_, this->last_destinations_, nullptr, 0, this->last_tag_, this->last_tag_len_,
+                                payload, std::min(static_cast<size_t>(payload_len), sizeof(payload) - 1));
     }
+    
+    // Repeats after the summary start a new window
+    this->last_hash_ = 0;
+    this->last_key_len_ = 0;
+}
+
+void SyslogComponent::set_repeat_window(uint32_t repeat_window_ms) {
+    this->flush_repeats_();
+    this->repeat_window_ms_ = repeat_window_ms;
 }
 
 float SyslogComponent::get_setup_priority() const {
@@ -8,14 +8,113 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/socket/socket.h"
 #include "esphome/components/text/text.h"
-#include <unordered_map>
-#include <set>
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+#include <ctime>
+#if defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(USE_HOST)
+#include <pthread.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include "ansi_strip.h"
+#include "capture_ring.h"
+#include "datagram_batch.h"
+#include "dns_resolver.h"
+#include "filter_list.h"
+#include "message_queue.h"
+#include "outage_buffer.h"
+#include "tag_filter.h"
+#include "tag_levels.h"
+#include "tcp_transport.h"
+
+// Logs can arrive from other tasks or threads than the main loop on these platforms
+#if defined(USE_ESP32) || defined(USE_HOST)
+#define SYSLOG_MULTI_THREADED
+#endif
 
 namespace esphome {
 namespace syslog {
 
+// Largest datagram the component sends (max_message_size); longer messages are
+// truncated or split according to the oversize policy
+#ifdef SYSLOG_MESSAGE_BUFFER_SIZE
+static const size_t SYSLOG_MAX_MESSAGE_SIZE = SYSLOG_MESSAGE_BUFFER_SIZE;
+#else
+static const size_t SYSLOG_MAX_MESSAGE_SIZE = 512;
+#endif
+
+// Slots of the capture ring for messages logged from other tasks or threads (capture_queue_size)
+#ifndef SYSLOG_CAPTURE_QUEUE_SIZE
+#define SYSLOG_CAPTURE_QUEUE_SIZE 16
+#endif
+
+// Longest logger message after color stripping; holds the logger's whole buffer so
+// the oversize policy is applied to the full text
+#ifdef SYSLOG_STRIP_BUFFER_SIZE
+static const size_t SYSLOG_MAX_STRIPPED_SIZE = SYSLOG_STRIP_BUFFER_SIZE;
+#else
+static const size_t SYSLOG_MAX_STRIPPED_SIZE = SYSLOG_MAX_MESSAGE_SIZE;
+#endif
+
+#ifdef USE_SYSLOG_STATIC_MEMORY
+// Capacities of the settings that can change at runtime (static_memory). They are
+// reserved when the component is created; longer values are rejected.
+static const size_t SYSLOG_MAX_FILTERS = SYSLOG_STATIC_MAX_FILTERS;
+static const size_t SYSLOG_FILTER_STORAGE_SIZE = SYSLOG_STATIC_FILTER_STORAGE;
+static const size_t SYSLOG_MAX_PREFIX_LENGTH = SYSLOG_STATIC_PREFIX_LENGTH;
+static const size_t SYSLOG_MAX_CLIENT_ID_LENGTH = SYSLOG_STATIC_CLIENT_ID_LENGTH;
+static const size_t SYSLOG_MAX_ADDRESS_LENGTH = SYSLOG_STATIC_ADDRESS_LENGTH;
+#else
+// Without static_memory these settings grow on the heap as needed
+static const size_t SYSLOG_MAX_FILTERS = SIZE_MAX;
+static const size_t SYSLOG_FILTER_STORAGE_SIZE = SIZE_MAX;
+static const size_t SYSLOG_MAX_PREFIX_LENGTH = SIZE_MAX;
+static const size_t SYSLOG_MAX_CLIENT_ID_LENGTH = SIZE_MAX;
+static const size_t SYSLOG_MAX_ADDRESS_LENGTH = SIZE_MAX;
+#endif
+
+// Longest message the component logs about itself
+static const size_t SYSLOG_INTERNAL_MESSAGE_SIZE = 192;
+
+// Messages replayed from the outage buffer per loop() once the network is back
+static const size_t SYSLOG_OUTAGE_REPLAY_BATCH = 8;
+
+// Minimum time between copies of the outage buffer into preferences (ms)
+static const uint32_t SYSLOG_OUTAGE_SAVE_INTERVAL = 10000;
+
+// Maximum number of logger tags whose filter decision is cached (at most 255)
+static const size_t SYSLOG_TAG_CACHE_SIZE = 64;
+
+// Slots of the tag cache's hash index, a power of two; twice the entries keeps probes short
+static const size_t SYSLOG_TAG_INDEX_SIZE = SYSLOG_TAG_CACHE_SIZE * 2;
+
+// Maximum number of servers, including the primary one; each message carries
+// one bit per server telling where it goes
+static const size_t SYSLOG_MAX_DESTINATIONS = 8;
+
+// Clock readings before 2019-01-01 mean the time source isn't synchronized yet
+static const time_t SYSLOG_MIN_VALID_EPOCH = 1546300800;
+
+// How often the adaptive sampling ratio is re-evaluated (ms)
+static const uint32_t SYSLOG_SAMPLING_ADJUST_INTERVAL = 250;
+
+// Destination mask bit of the primary server
+static const uint8_t SYSLOG_PRIMARY_DESTINATION = 0x01;
+
+// Syslog severities (RFC 5424) queued in the urgent lane: emergency through warning
+static const uint8_t SYSLOG_URGENT_SEVERITY = 4;
+
 /**
  * @brief Defines the source of a log message
  */
@@ -25,14 +124,172 @@ enum class LogSource {
     INTERNAL     // Messages from the syslog component itself
 };
 
+/**
+ * @brief How messages reach the primary server
+ */
+enum class Transport {
+    UDP,        // One datagram per message (RFC 5426)
+    TCP         // Octet-counted frames over a stream connection (RFC 6587)
+};
+
+/**
+ * @brief What to do with a message that doesn't fit in one datagram
+ */
+enum class OversizePolicy {
+    TRUNCATE,   // Cut the message and end it with a "..." marker
+    SPLIT       // Send numbered continuation datagrams that share a message ID
+};
+
+/**
+ * @brief Send queue lanes, drained in this order
+ */
+enum class Lane : uint8_t {
+    URGENT,     // ERROR and WARN, in slots reserved for them
+    BULK        // INFO and below
+};
+static const size_t SYSLOG_LANE_COUNT = 2;
+
 /**
  * @brief Settings structure for Syslog configuration
  */
 struct SyslogSettings {
-    std::string address;      // IP address of the syslog server
+    std::string address;      // IP address or hostname of the syslog server
     uint16_t port;            // Port of the syslog server
     std::string client_id;    // Client identifier to include in syslog messages
     int min_log_level;        // Minimum log level to forward
+    uint8_t facility = 0;     // Syslog facility code (0 = kern ... 23 = local7)
+};
+
+/**
+ * @brief Additional server that receives a copy of the message stream
+ *
+ * Each destination has its own minimum level and tag filter, the formatted
+ * message is shared with the primary server.
+ */
+struct SyslogDestination {
+    std::string address;                  // IP address of the server
+    uint16_t port;                        // Port of the server
+    int min_log_level;                    // Minimum level of logger and direct messages
+    TagFilter tag_filter;                 // Compiled filter for logger tags
+    struct sockaddr_storage server;       // Parsed address
+    socklen_t server_socklen = 0;         // 0 if the address couldn't be parsed
+    std::unique_ptr<socket::Socket> socket;  // Only used if the primary socket has another address family
+};
+
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+/**
+ * @brief Outage buffer contents as stored in flash preferences
+ */
+struct OutageSnapshot {
+    uint32_t lost;                              // Messages lost to overflow or left out of data
+    uint16_t length;                            // Bytes used in data
+    uint8_t data[SYSLOG_OUTAGE_PERSIST_SIZE];   // Newest records in OutageBuffer format, oldest first
+};
+#endif
+
+/**
+ * @brief Counters describing what the component did since boot
+ */
+struct SyslogStats {
+    uint32_t captured = 0;        // Messages handed to the component (logger and direct)
+    uint32_t filtered = 0;        // Rejected by tag filters, rate limits, sampling or repeat coalescing
+    uint32_t sent = 0;            // Datagrams sent successfully (one per destination)
+    uint32_t send_failures = 0;   // Datagrams the network stack refused
+    uint32_t send_calls = 0;      // System calls that sent datagrams (sendto() or sendmmsg())
+    uint64_t bytes_sent = 0;      // Payload bytes of the sent datagrams (64-bit, 32 bits wrap after 4 GB)
+    uint32_t outage_lost = 0;     // Messages lost to outage buffer overflow
+    uint32_t unreachable = 0;     // Datagrams not sent to a destination that couldn't be reached, without an outage buffer
+    uint64_t log_time_us = 0;     // Cumulative time spent capturing messages (32 bits wrap after 71 minutes)
+    uint32_t log_time_max_us = 0; // Longest single capture
+
+    void add_log_time(uint32_t us) {
+        this->log_time_us += us;
+        if (us > this->log_time_max_us) {
+            this->log_time_max_us = us;
+        }
+    }
+};
+
+/**
+ * @brief Counters of one send queue lane
+ */
+struct LaneStats {
+    uint32_t dequeued = 0;        // Messages taken from the lane and handed to the network
+    uint64_t latency_us = 0;      // Cumulative time they waited in the lane
+    uint32_t latency_max_us = 0;  // Longest wait
+
+    void add_latency(uint32_t us) {
+        this->dequeued++;
+        this->latency_us += us;
+        if (us > this->latency_max_us) {
+            this->latency_max_us = us;
+        }
+    }
+    uint32_t average_latency_us() const {
+        return this->dequeued ? static_cast<uint32_t>(this->latency_us / this->dequeued) : 0;
+    }
+};
+
+/**
+ * @brief Token bucket used to rate limit logger messages
+ *
+ * Holds up to burst tokens and refills at rate tokens per second; each
+ * message takes one token. A rate of 0 disables the limit.
+ */
+struct TokenBucket {
+    float tokens = 0;           // Tokens currently available
+    uint32_t last_refill = 0;   // millis() of the last refill
+    uint32_t suppressed = 0;    // Messages dropped since the last summary
+
+    void reset(float burst, uint32_t now) {
+        this->tokens = burst;
+        this->last_refill = now;
+    }
+    void refill(float rate, float burst, uint32_t now) {
+        this->tokens = std::min(burst, this->tokens + (now - this->last_refill) * rate / 1000.0f);
+        this->last_refill = now;
+    }
+    // Whether consume() would succeed, without taking the token
+    bool available(float rate, float burst, uint32_t now) {
+        if (rate <= 0) {
+            return true;
+        }
+        this->refill(rate, burst, now);
+        return this->tokens >= 1.0f;
+    }
+    bool consume(float rate, float burst, uint32_t now) {
+        if (!this->available(rate, burst, now)) {
+            return false;
+        }
+        if (rate > 0) {
+            this->tokens -= 1.0f;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Keeps 1 in ratio messages of the low-severity levels under backpressure
+ *
+ * The ratio is a power of two, doubled while the send path falls behind and
+ * halved once it has caught up; a ratio of 1 lets everything through.
+ */
+struct AdaptiveSampler {
+    uint16_t ratio = 1;         // Current 1-in-N ratio
+    uint16_t counter = 0;       // Messages seen since the last one kept
+    uint32_t skipped = 0;       // Messages skipped since the last summary
+
+    bool sample() {
+        if (this->ratio <= 1) {
+            return true;
+        }
+        if (++this->counter >= this->ratio) {
+            this->counter = 0;
+            return true;
+        }
+        this->skipped++;
+        return false;
+    }
 };
 
 /**
@@ -46,20 +303,50 @@ class SyslogComponent : public Component {
 
         void setup() override;
         void loop() override;
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        void on_shutdown() override;
+#endif
         
         // Runtime changeable settings
-        void set_server_ip(const std::string &address);
+        // The setters taking strings return false (and keep the old value) if it doesn't fit
+        // the capacity reserved for it in static memory mode
+        bool set_server_ip(const std::string &address);
         const std::string &get_server_ip() const { return this->settings_.address; }
         
         void set_server_port(uint16_t port);
         uint16_t get_server_port() const { return this->settings_.port; }
         
-        void set_client_id(const std::string &client_id);
+        // How long a resolved server hostname is cached before it is looked up again
+        void set_dns_ttl(uint32_t ttl_ms) { this->resolver_.set_ttl(ttl_ms); }
+        uint32_t get_dns_ttl() const { return this->resolver_.get_ttl(); }
+        // Whether the server address is known (always true for a literal IP)
+        bool is_server_resolved() const { return this->server_socklen != 0; }
+        
+        // Transport to the primary server; only effective before setup()
+        void set_transport(Transport transport) { this->transport_ = transport; }
+        Transport get_transport() const { return this->transport_; }
+        void set_tcp_buffer_size(size_t size) { this->tcp_buffer_size_ = size; }
+        size_t get_tcp_buffer_size() const { return this->tcp_buffer_size_; }
+        bool is_tcp_connected() const { return this->tcp_.is_connected(); }
+        
+        bool set_client_id(const std::string &client_id);
         const std::string &get_client_id() const { return this->settings_.client_id; }
         
-        void set_min_log_level(int log_level) { this->settings_.min_log_level = log_level; }
+        void set_facility(uint8_t facility);
+        uint8_t get_facility() const { return this->settings_.facility; }
+        
+        void set_min_log_level(int log_level);
         int get_min_log_level() const { return this->settings_.min_log_level; }
         
+        // Per-tag minimum levels of logger messages for the primary server, overriding min_level.
+        // The table is generated from the configuration, sorted by tag.
+        void set_tag_levels(const TagLevels::Entry *table, size_t count);
+        // Runtime override for one tag, kept in a fixed number of slots; returns false if they are all taken
+        bool set_tag_level(const char *tag, int level);
+        void reset_tag_level(const char *tag);
+        // Minimum level for the tag, -1 if it follows min_level
+        int get_tag_level(const char *tag) const { return this->tag_levels_.find(tag); }
+        
         void set_enable_logger_messages(bool en);
         bool get_enable_logger_messages() const { return this->enable_logger; }
         
@@ -75,24 +362,25 @@ class SyslogComponent : public Component {
         bool is_setup() const { return this->socket_ != nullptr; }
 
         // Log source prefixing
-        void set_direct_log_prefix(const std::string &prefix);
+        bool set_direct_log_prefix(const std::string &prefix);
         const std::string &get_direct_log_prefix() const { return this->direct_log_prefix; }
         
-        void set_logger_log_prefix(const std::string &prefix);
+        bool set_logger_log_prefix(const std::string &prefix);
         const std::string &get_logger_log_prefix() const { return this->logger_log_prefix; }
 
         // Filter management
-        void set_filter_mode(bool include_mode) { this->filter_include_mode = include_mode; }
-        bool get_filter_mode() const { return this->filter_include_mode; }
+        void set_filter_mode(bool include_mode);
+        bool get_filter_mode() const { return this->filters_().include_mode; }
         
         void clear_filters();
-        void add_filter(const std::string &tag);
+        bool add_filter(const std::string &tag);
         void remove_filter(const std::string &tag);
         bool has_filter(const std::string &tag) const;
+        // Copies the list, which allocates; the component itself never calls it
         std::vector<std::string> get_filters() const;
         
         // Filter string methods (comma-separated list)
-        void set_filter_string(const std::string &filter_string);
+        bool set_filter_string(const std::string &filter_string);
         const std::string &get_filter_string() const { return this->filter_string; }
         
         // Register a text sensor for the filter string
@@ -104,8 +392,116 @@ class SyslogComponent : public Component {
             }
         }
         
+        // Additional servers; only effective before setup()
+        void add_destination(const std::string &address, uint16_t port, int min_log_level,
+                             bool include_mode, const std::vector<std::string> &filters);
+        size_t get_destination_count() const { return this->destinations_.size(); }
+        
+        // Send queue settings; ERROR and WARN get urgent_queue_size slots of their own on top of
+        // queue_size (0 = a single lane). Only effective before setup().
+        void set_queue_size(size_t queue_size) { this->queue_size_ = queue_size; }
+        size_t get_queue_size() const { return this->queue_size_; }
+        void set_urgent_queue_size(size_t size) { this->urgent_queue_size_ = size; }
+        size_t get_urgent_queue_size() const { return this->urgent_queue_size_; }
+
+        void set_max_loop_time(uint32_t max_loop_time_us) { this->max_loop_time_us_ = max_loop_time_us; }
+        uint32_t get_max_loop_time() const { return this->max_loop_time_us_; }
+
+        void set_drop_policy(DropPolicy policy) { this->drop_policy_ = policy; }
+        DropPolicy get_drop_policy() const { return this->drop_policy_; }
+
+        uint32_t get_dropped_count() const {
+            return this->queues_[0].get_dropped_count() + this->queues_[1].get_dropped_count();
+        }
+        uint32_t get_lane_dropped_count(Lane lane) const {
+            return this->queues_[static_cast<size_t>(lane)].get_dropped_count();
+        }
+        const LaneStats &get_lane_stats(Lane lane) const { return this->lane_stats_[static_cast<size_t>(lane)]; }
+
+        // Slots for messages logged from other tasks or threads until loop() picks them up
+        // (capture_queue_size, fixed at compile time)
+        size_t get_capture_queue_size() const { return SYSLOG_CAPTURE_QUEUE_SIZE; }
+        // Messages from other threads lost because the capture ring was full
+        uint32_t get_capture_dropped_count() const { return this->capture_ring_.get_dropped_count(); }
+
+        // Capture-time TIMESTAMP and sysUpTime, and per-message sequence numbers
+        void set_timestamps(bool timestamps) { this->timestamps_ = timestamps; }
+        bool get_timestamps() const { return this->timestamps_; }
+        void set_sequence_ids(bool sequence_ids) { this->sequence_ids_ = sequence_ids; }
+        bool get_sequence_ids() const { return this->sequence_ids_; }
+        // sequenceId of the last formatted message
+        uint32_t get_sequence_id() const { return this->sequence_id_; }
+#ifdef USE_TIME
+        void set_time(time::RealTimeClock *time) { this->time_ = time; }
+#endif
+
+        // Handling of messages longer than max_message_size
+        void set_oversize_policy(OversizePolicy policy) { this->oversize_policy_ = policy; }
+        OversizePolicy get_oversize_policy() const { return this->oversize_policy_; }
+
+        // Outage buffer size in bytes (0 = disabled); only effective before setup()
+        void set_outage_buffer_size(size_t size) { this->outage_buffer_size_ = size; }
+        size_t get_outage_buffer_size() const { return this->outage_buffer_size_; }
+        size_t get_outage_buffered_count() const { return this->outage_.size(); }
+
+        // Boot buffer size in bytes (0 = disabled); allocates it and attaches to the logger right away
+        void set_boot_buffer_size(size_t size);
+        size_t get_boot_buffered_count() const { return this->boot_.size(); }
+
+        // Statistics
+        const SyslogStats &get_stats() const { return this->stats_; }
+        uint32_t get_total_dropped_count() const {
+            return this->get_dropped_count() + this->stats_.outage_lost + this->stats_.unreachable +
+                   this->get_capture_dropped_count();
+        }
+        size_t get_queue_high_water() const { return this->queue_high_water_; }
+
+        // How often sensors are published and the optional report line is sent (0 = never)
+        void set_stats_interval(uint32_t interval_ms) { this->stats_interval_ms_ = interval_ms; }
+        void set_stats_report(bool report) { this->stats_report_ = report; }
+
+#ifdef USE_SENSOR
+        void set_captured_sensor(sensor::Sensor *sensor) { this->captured_sensor_ = sensor; }
+        void set_filtered_sensor(sensor::Sensor *sensor) { this->filtered_sensor_ = sensor; }
+        void set_sent_sensor(sensor::Sensor *sensor) { this->sent_sensor_ = sensor; }
+        void set_send_failures_sensor(sensor::Sensor *sensor) { this->send_failures_sensor_ = sensor; }
+        void set_bytes_sent_sensor(sensor::Sensor *sensor) { this->bytes_sent_sensor_ = sensor; }
+        void set_dropped_sensor(sensor::Sensor *sensor) { this->dropped_sensor_ = sensor; }
+        void set_queue_high_water_sensor(sensor::Sensor *sensor) { this->queue_high_water_sensor_ = sensor; }
+        void set_log_time_total_sensor(sensor::Sensor *sensor) { this->log_time_total_sensor_ = sensor; }
+        void set_log_time_max_sensor(sensor::Sensor *sensor) { this->log_time_max_sensor_ = sensor; }
+        void set_urgent_dropped_sensor(sensor::Sensor *sensor) { this->lane_sensors_[0].dropped = sensor; }
+        void set_urgent_latency_avg_sensor(sensor::Sensor *sensor) { this->lane_sensors_[0].latency_avg = sensor; }
+        void set_urgent_latency_max_sensor(sensor::Sensor *sensor) { this->lane_sensors_[0].latency_max = sensor; }
+        void set_bulk_dropped_sensor(sensor::Sensor *sensor) { this->lane_sensors_[1].dropped = sensor; }
+        void set_bulk_latency_avg_sensor(sensor::Sensor *sensor) { this->lane_sensors_[1].latency_avg = sensor; }
+        void set_bulk_latency_max_sensor(sensor::Sensor *sensor) { this->lane_sensors_[1].latency_max = sensor; }
+#endif
+
+        // Coalescing of consecutive identical messages (0 = disabled)
+        void set_repeat_window(uint32_t repeat_window_ms);
+        uint32_t get_repeat_window() const { return this->repeat_window_ms_; }
+
+        // Adaptive sampling of DEBUG and lower logger messages under backpressure (max_ratio 0 = disabled,
+        // rounded down to a power of two)
+        void set_adaptive_sampling(uint16_t max_ratio, uint32_t report_interval_ms);
+        uint16_t get_sampling_ratio() const { return this->sampler_.ratio; }
+
+        // Rate limiting of logger messages (rate in messages per second, 0 = unlimited;
+        // burst 0 = same as rate)
+        void set_tag_rate_limit(float rate, float burst);
+        float get_tag_rate() const { return this->tag_rate_; }
+        float get_tag_burst() const { return this->tag_burst_; }
+
+        void set_global_rate_limit(float rate, float burst);
+        float get_global_rate() const { return this->global_rate_; }
+        float get_global_burst() const { return this->global_burst_; }
+
         // Main logging function
         void log(uint8_t level, const std::string &tag, const std::string &payload, LogSource source = LogSource::DIRECT);
+        // Allocation-free variant taking pointer/length views, used by the logger callback
+        void log(uint8_t level, const char *tag, size_t tag_len, const char *payload, size_t payload_len,
+                 LogSource source = LogSource::DIRECT);
         LogSource get_message_source(const std::string &tag) const;
         
         // Helper method to extract component name from the tag
@@ -113,24 +509,313 @@ class SyslogComponent : public Component {
         
         // Method to check if a tag should be filtered
         bool should_send_log(const std::string &tag);
+        
+        // Drop all cached per-tag decisions (called whenever filters, prefixes or mode change)
+        void invalidate_tag_cache();
 
     protected:
+        /**
+         * @brief Cached decision for one logger tag
+         */
+        struct TagCacheEntry {
+            const char *tag;            // Static logger tag, the cache key
+            size_t tag_len;
+            uint8_t destinations;       // Destinations whose tag filter accepts the tag
+            int8_t min_level;           // Primary server's minimum level for the tag, -1 = min_level
+            bool prefixed;              // Whether the logger prefix goes in front of the tag
+            TokenBucket bucket;         // Per-tag rate limit state
+        };
+        
+        /**
+         * @brief One complete set of filters for the primary server
+         *
+         * Changes are made to a copy of the active set, which only replaces it
+         * once it is compiled, so a message is never checked against a half
+         * built list.
+         */
+        struct FilterSet {
+            FilterList tags;            // Sorted tags to filter
+            TagFilter compiled;         // Compiled form of tags
+            bool include_mode = false;  // true=include, false=exclude
+        };
+        
+        // Handle a message from the ESPHome logger callback
+        void on_logger_message_(int level, const char *tag, const char *message);
+        // Whether the caller runs on the thread that runs loop(); everything but the capture ring
+        // is only touched from there
+        bool is_loop_thread_() const;
+        // Process messages other threads left in the capture ring
+        void drain_capture_ring_();
+        // Publish the highest level each source can be kept at, for the checks other threads make
+        // before taking a ring slot
+        void update_capture_levels_();
+        // Capture time of the message being formatted: when it was pushed if it came through the ring
+        uint32_t capture_millis_() const;
+        // Find or create the cache entry for a logger tag (keyed on its static pointer)
+        TagCacheEntry &lookup_tag_(const char *tag);
+        // Format a message about the component itself and send it like a direct log line
+        void log_internal_(uint8_t level, const char *format, ...) __attribute__((format(printf, 3, 4)));
+        // Log how much memory the buffers hold, and whether anything can still grow
+        void log_memory_usage_();
+        // Normalize a log prefix into out ("name: "); returns false if it exceeds the reserved capacity
+        bool assign_prefix_(std::string &out, const std::string &prefix, const char *what);
+        // Whether the rate limits allow another message from this tag
+        bool check_rate_limit_(const char *tag, TagCacheEntry &entry);
+        // Bucket size for a rate, a burst of 0 means one second worth of messages
+        static float get_effective_burst_(float rate, float burst) { return burst > 0 ? burst : std::max(rate, 1.0f); }
+        // Send "suppressed N messages" summaries for buckets that refilled (or all, if forced)
+        void report_suppressed_(bool force);
+        // Raise or lower the sampling ratio from the queue fill level, drops and send failures
+        void update_sampling_();
+        // Send the "sampled ... skipped N messages" summary
+        void report_sampling_();
+        // Parse settings_.address/port into server/server_socklen; keeps the old values on failure.
+        // A hostname is handed to the resolver and leaves server_socklen at 0 until it resolves.
+        bool update_server_address_();
+        // Collect finished hostname lookups and start refreshes; called from loop()
+        void poll_resolver_();
+        // Start, complete or retry the TCP connection and log its state changes; called from loop()
+        void poll_tcp_();
+        // Point the TCP connection at the current server address
+        void update_tcp_address_();
+        // Whether the primary server goes over TCP and its buffer has no room for a message of len bytes
+        bool tcp_full_(size_t len, uint8_t destinations) const;
+        // Whether the network is up and the primary server reachable (resolved, and connected for TCP)
+        bool can_send_() const;
+        // Mask of the destinations that can be sent to now; the primary server waits for its address and TCP connection
+        uint8_t ready_destinations_() const;
+        // Create the UDP socket unless one for the current address family exists
+        bool ensure_socket_();
+        // Create sockets for additional destinations whose address family differs from the primary one
+        void ensure_destination_sockets_();
+        // Apply a runtime address or port change without re-running setup()
+        void update_destination_();
+        // Recompute which destinations accept each level after a min_level change
+        void rebuild_level_masks_();
+        // Mask with a bit for every configured destination
+        uint8_t all_destinations_() const { return (1u << (this->destinations_.size() + 1)) - 1; }
+        // Filters messages are currently checked against
+        const FilterSet &filters_() const { return *this->active_filters_.load(std::memory_order_acquire); }
+        // Copy of the active filters to make a change in; nothing reads it until it is published
+        FilterSet &stage_filters_();
+        // Compile the staged filters and swap them in; returns false (keeping the active ones) if they don't fit
+        bool publish_filters_(FilterSet &staged);
+        // Rebuild the per-level header templates after the client ID or facility changed
+        void rebuild_headers_();
+        // Check the socket and repeat coalescing, then format and queue the message
+        void send_formatted_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                             const char *tag, size_t tag_len, const char *payload, size_t payload_len);
+        // Publish the statistics sensors and send the report line if enabled
+        void publish_stats_();
+        // Format a message into the send buffer once, whatever the number of destinations; returns its length
+        size_t format_(uint8_t level, const char *prefix, size_t prefix_len,
+                       const char *tag, size_t tag_len, const char *payload, size_t payload_len);
+        // Write "<PRI>1 TIMESTAMP client_id prefixtag" into the send buffer and prepare the
+        // message's structured data; returns the length
+        size_t format_header_(uint8_t level, const char *prefix, size_t prefix_len, const char *tag, size_t tag_len);
+        // Write " PROCID MSGID STRUCTURED-DATA BOM" at pos; returns the new length
+        size_t write_trailer_(size_t pos, const char *msgid, size_t msgid_len);
+        // Write the RFC 5424 TIMESTAMP for captured_ms (a millis() value) into out; returns 0 if the
+        // clock isn't valid
+        size_t format_timestamp_(char *out, size_t size, uint32_t captured_ms);
+        // Number the message and build its "meta" structured data
+        void format_structured_data_(uint32_t captured_ms);
+        // Queue one formatted datagram from the send buffer, or keep it in the outage buffer if there is no socket
+        void enqueue_(uint8_t level, size_t len, uint8_t destinations);
+        // Queue a payload too long for one datagram as numbered fragments behind the header
+        // already in the send buffer; returns false if the header leaves no room to split
+        bool queue_fragments_(uint8_t level, size_t header_len, uint8_t destinations, const char *payload,
+                              size_t payload_len);
+        // Lane a message of this ESPHome level is queued in
+        Lane lane_for_level_(uint8_t level) const;
+        bool queues_empty_() const { return this->queues_[0].empty() && this->queues_[1].empty(); }
+        size_t queued_count_() const { return this->queues_[0].size() + this->queues_[1].size(); }
+        // Send queued messages batch by batch, urgent lane first, until both lanes are empty or the
+        // time budget is used up; only the destinations in ready are sent to
+        void drain_queue_(uint32_t start, uint8_t ready);
+        // Send one datagram to every destination in the mask; returns the mask of destinations that failed
+        uint8_t send_datagram_(const char *data, size_t len, uint8_t destinations);
+        // Add a datagram to the batch for the destinations using the primary socket, and send it to the
+        // others right away; returns the mask of destinations that already failed
+        uint8_t add_datagram_(uint8_t message, const char *data, size_t len, uint8_t destinations);
+        // Send the batch and add the destinations that failed to failed[message] of each entry. With
+        // deferred, the ones left untried because the send buffer was full go there instead of failing.
+        void send_batch_(uint8_t *failed, uint8_t *deferred = nullptr);
+        // Count a sent or failed datagram in the statistics; returns sent
+        bool count_send_(bool sent, size_t len);
+        // Log a send failure once per failure streak
+        void warn_send_failure_(size_t len);
+        // Move everything in the send queue (urgent lane first) to the end of the outage buffer
+        void spill_queue_to_outage_();
+        // Send the lost-message marker and a batch of messages from the outage or boot buffer
+        void replay_buffer_(OutageBuffer &buffer, const char *lost_reason, uint32_t start);
+        // Send a batch of boot messages and free the boot buffer once it is empty
+        void flush_boot_buffer_();
+        // Add the logger callback unless that was done already
+        void register_logger_callback_();
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        // Restore the outage buffer from preferences
+        void load_outage_();
+        // Copy the outage buffer into preferences if it changed
+        void save_outage_(bool force);
+#endif
+        // Whether count fragments of a message fit where it is queued without pushing out each other
+        bool fragments_fit_(uint8_t level, size_t count) const;
+        // Format a message into the send buffer and queue it, splitting it if the policy asks for that
+        void format_and_queue_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                               const char *tag, size_t tag_len, const char *payload, size_t payload_len);
+        // Whether the message repeats the previous one within the repeat window (and is held back)
+        bool is_repeat_(uint8_t level, uint8_t destinations, const char *prefix, size_t prefix_len,
+                        const char *tag, size_t tag_len, const char *payload, size_t payload_len);
+        // Send "last message repeated N times" for held back repeats
+        void flush_repeats_();
+
         bool strip_colors;                    // Whether to strip color codes from logger messages
         bool enable_logger;                   // Enable capturing from ESPHome logger
         bool enable_direct_logs;              // Enable direct API logging calls
         bool globally_enabled;                // Global on/off switch for the component
-        bool filter_include_mode;             // Filter mode: true=include, false=exclude
-        std::set<std::string> tag_filters;    // Set of tags to filter
+        FilterSet filter_sets_[2];            // The active filters and the ones the next change is staged in
+        std::atomic<FilterSet *> active_filters_{nullptr};  // Points into filter_sets_, replaced in one store
         std::string filter_string;            // Original comma-separated filter string
         text::Text *filter_string_text_ = nullptr;  // Text sensor for filter string
         SyslogSettings settings_;             // Connection settings
         std::unique_ptr<socket::Socket> socket_ = nullptr;  // UDP socket
         struct sockaddr_storage server;       // Server address
-        socklen_t server_socklen;             // Server address length
+        socklen_t server_socklen = 0;         // Server address length, 0 while a hostname is unresolved
+        DnsResolver resolver_;                // Background lookups when the server is a hostname
+        int socket_family_ = AF_UNSPEC;       // Address family the socket was created for
+        Transport transport_ = Transport::UDP;
+        TcpTransport tcp_;                    // Connection to the primary server if the transport is TCP
+        TcpTransport::State tcp_state_ = TcpTransport::State::DISCONNECTED;  // State at the last poll
+        uint32_t tcp_failures_ = 0;           // Failure count at the last poll
+        size_t tcp_buffer_size_ = 2048;       // Bytes of frames waiting to be written
+        std::vector<SyslogDestination> destinations_;  // Additional servers, mask bit i + 1
+        uint8_t level_masks_[8] = {};         // Destinations accepting each ESPHome level
+        TagLevels tag_levels_;                // Per-tag minimum levels for the primary server
+        bool logger_callback_registered_ = false;  // Logger callback is only added once
         
         // Prefix settings for different log sources
         std::string direct_log_prefix;        // Prefix for direct logs
         std::string logger_log_prefix;        // Prefix for logger messages
+
+        // Capture ring: messages logged from other threads wait here for the loop thread
+        CaptureRing capture_ring_;
+        // Highest level worth capturing per LogSource, -1 for none; only the loop thread writes them
+        std::atomic<int8_t> capture_levels_[3];
+        uint32_t ring_captured_ms_ = 0;       // Capture time of the ring entry being processed
+        bool from_capture_ring_ = false;      // Whether the message being processed came from the ring
+#if defined(USE_ESP32)
+        TaskHandle_t loop_task_ = nullptr;    // Task that runs setup() and loop()
+#elif defined(USE_HOST)
+        pthread_t loop_thread_;               // Thread that runs setup() and loop()
+#endif
+
+        // Send queue: log() only enqueues, loop() drains to the socket, urgent lane first
+        MessageQueue queues_[SYSLOG_LANE_COUNT];  // Preallocated rings of formatted datagrams, indexed by Lane
+        LaneStats lane_stats_[SYSLOG_LANE_COUNT];
+        size_t queue_size_ = 8;               // Number of bulk lane slots
+        size_t urgent_queue_size_ = 2;        // Number of urgent lane slots, on top of queue_size_
+        size_t queue_high_water_ = 0;         // Most messages queued in both lanes at once
+        uint32_t max_loop_time_us_ = 2000;    // Time budget per loop() drain
+        DropPolicy drop_policy_ = DropPolicy::DROP_OLDEST;
+        OversizePolicy oversize_policy_ = OversizePolicy::TRUNCATE;
+        uint16_t fragment_id_ = 0;            // Message ID of the last split message
+
+        // Capture-time stamping
+        bool timestamps_ = false;             // Add TIMESTAMP (if the clock is valid) and sysUpTime
+        bool sequence_ids_ = false;           // Add a sequenceId to every message
+        uint32_t sequence_id_ = 0;            // sequenceId of the last formatted message
+        char structured_data_[64] = "-";      // STRUCTURED-DATA of the message being formatted
+        size_t structured_data_len_ = 1;
+#ifdef USE_TIME
+        time::RealTimeClock *time_ = nullptr;
+        int64_t clock_offset_ms_ = 0;         // Wall clock ms minus millis()
+        bool clock_offset_valid_ = false;
+        time_t timestamp_second_ = 0;         // Second timestamp_cache_ was formatted for
+        char timestamp_cache_[24];            // "YYYY-MM-DDTHH:MM:SS" of timestamp_second_
+        size_t timestamp_cache_len_ = 0;
+#endif
+        uint32_t reported_dropped_[SYSLOG_LANE_COUNT] = {};  // Drop count of each lane at the last drop report
+        std::string level_headers_[8];        // Precomputed "<PRI>1 " per ESPHome level
+        std::string hostname_field_;          // Precomputed " client_id "
+        char send_buffer_[SYSLOG_MAX_MESSAGE_SIZE];  // Reusable buffer each message is formatted into
+        char strip_buffer_[SYSLOG_MAX_STRIPPED_SIZE]; // Stripped message text when it can't be a view
+        bool send_failing_ = false;           // Suppresses repeated send failure warnings
+        HighFrequencyLoopRequester high_freq_;  // Keeps loop() fast while the queue has messages
+        DatagramBatch batch_;                 // Datagrams for the primary socket, sent together
+
+        TagCacheEntry tag_cache_[SYSLOG_TAG_CACHE_SIZE];  // Per-tag decisions for logger messages
+        size_t tag_cache_count_ = 0;          // Entries in use, in the order they were added
+        uint8_t tag_index_[SYSLOG_TAG_INDEX_SIZE];  // Open addressing on the tag pointer, 0xFF = free
+        TagCacheEntry uncached_tag_;          // Scratch entry used once the cache is full
+        TokenBucket overflow_bucket_;         // Rate limit shared by the tags that don't fit in the cache
+
+        // Rate limiting, evaluated in the logger callback before formatting
+        float tag_rate_ = 0;                  // Per-tag messages per second (0 = unlimited)
+        float tag_burst_ = 0;                 // Per-tag bucket size
+        float global_rate_ = 0;               // Messages per second over all tags (0 = unlimited)
+        float global_burst_ = 0;              // Global bucket size
+        TokenBucket global_bucket_;           // Shared by all logger messages
+        uint32_t last_suppressed_report_ = 0; // millis() of the last summary scan
+
+        // Adaptive sampling, evaluated in the logger callback after the rate limits
+        AdaptiveSampler sampler_;
+        uint16_t sampling_max_ratio_ = 0;     // Largest ratio (0 = sampling disabled)
+        uint32_t sampling_report_interval_ms_ = 10000;
+        uint32_t last_sampling_adjust_ = 0;   // millis() of the last ratio update
+        uint32_t last_sampling_report_ = 0;   // millis() of the last summary
+        size_t sampling_peak_ = 0;            // Most messages queued since the last update
+        uint32_t sampling_dropped_ = 0;       // Queue drops at the last update
+        uint32_t sampling_failures_ = 0;      // Send failures at the last update
+
+        // Boot buffer, holds messages logged before setup() created the socket; freed once sent
+        OutageBuffer boot_;
+
+        // Outage buffer, holds formatted messages while the network is down
+        OutageBuffer outage_;
+        size_t outage_buffer_size_ = 0;       // Byte budget (0 = disabled)
+        bool outage_dirty_ = false;           // Changed since the last save to preferences
+#ifdef USE_SYSLOG_OUTAGE_PERSISTENCE
+        ESPPreferenceObject outage_pref_;
+        uint32_t last_outage_save_ = 0;       // millis() of the last save
+#ifdef USE_SYSLOG_STATIC_MEMORY
+        std::unique_ptr<OutageSnapshot> outage_snapshot_;  // Allocated by load_outage_() and reused for every save
+#endif
+#endif
+
+        // Statistics
+        SyslogStats stats_;
+        uint8_t capture_depth_ = 0;           // Capture calls in progress; nested ones (internal messages) aren't counted
+        uint32_t stats_interval_ms_ = 60000;  // Publish interval (0 = never)
+        bool stats_report_ = false;           // Also send a report line every interval
+#ifdef USE_SENSOR
+        sensor::Sensor *captured_sensor_ = nullptr;
+        sensor::Sensor *filtered_sensor_ = nullptr;
+        sensor::Sensor *sent_sensor_ = nullptr;
+        sensor::Sensor *send_failures_sensor_ = nullptr;
+        sensor::Sensor *bytes_sent_sensor_ = nullptr;
+        sensor::Sensor *dropped_sensor_ = nullptr;
+        sensor::Sensor *queue_high_water_sensor_ = nullptr;
+        sensor::Sensor *log_time_total_sensor_ = nullptr;
+        sensor::Sensor *log_time_max_sensor_ = nullptr;
+        struct {
+            sensor::Sensor *dropped = nullptr;
+            sensor::Sensor *latency_avg = nullptr;
+            sensor::Sensor *latency_max = nullptr;
+        } lane_sensors_[SYSLOG_LANE_COUNT];   // Per-lane counters, indexed by Lane
+#endif
+
+        // Repeat coalescing ("last message repeated N times")
+        uint32_t repeat_window_ms_ = 0;       // Window in which identical messages are held back
+        uint32_t last_hash_ = 0;              // Hash of level, destinations, tag and payload of the last sent message
+        char last_key_[SYSLOG_MAX_MESSAGE_SIZE];  // Prefix, tag, NUL and payload of the last sent message
+        size_t last_key_len_ = 0;             // 0 = nothing to compare against (flushed, or too long to keep)
+        uint32_t last_sent_time_ = 0;         // millis() when the last message was sent
+        uint32_t repeat_count_ = 0;           // Repeats held back since then
+        uint8_t last_level_ = 0;              // Level of the last sent message
+        uint8_t last_destinations_ = 0;       // Destinations of the last sent message
+        char last_tag_[64];                   // Tag of the last sent message, used for the summary
+        size_t last_tag_len_ = 0;
 };
 
 /**
@@ -206,6 +891,68 @@ protected:
     SyslogComponent *parent_;
 };
 
+/**
+ * @brief Action to change the per-tag rate limit
+ */
+template<typename... Ts> class SyslogSetTagRateLimitAction : public Action<Ts...> {
+public:
+    explicit SyslogSetTagRateLimitAction(SyslogComponent *parent) : parent_(parent) {}
+    TEMPLATABLE_VALUE(float, rate)
+    TEMPLATABLE_VALUE(float, burst)
+    void play(Ts... x) override {
+        this->parent_->set_tag_rate_limit(this->rate_.value(x...), this->burst_.value(x...));
+    }
+protected:
+    SyslogComponent *parent_;
+};
+
+/**
+ * @brief Action to override the minimum level of one logger tag
+ */
+template<typename... Ts> class SyslogSetLevelAction : public Action<Ts...> {
+public:
+    explicit SyslogSetLevelAction(SyslogComponent *parent) : parent_(parent) {}
+    // The tag is a string literal from the configuration, so playing the action never allocates
+    void set_tag(const char *tag) { this->tag_ = tag; }
+    TEMPLATABLE_VALUE(int, level)
+    void play(Ts... x) override {
+        this->parent_->set_tag_level(this->tag_, this->level_.value(x...));
+    }
+protected:
+    SyslogComponent *parent_;
+    const char *tag_ = "";
+};
+
+/**
+ * @brief Action to drop the runtime level override of one logger tag
+ */
+template<typename... Ts> class SyslogResetLevelAction : public Action<Ts...> {
+public:
+    explicit SyslogResetLevelAction(SyslogComponent *parent) : parent_(parent) {}
+    void set_tag(const char *tag) { this->tag_ = tag; }
+    void play(Ts... x) override {
+        this->parent_->reset_tag_level(this->tag_);
+    }
+protected:
+    SyslogComponent *parent_;
+    const char *tag_ = "";
+};
+
+/**
+ * @brief Action to change the global rate limit
+ */
+template<typename... Ts> class SyslogSetGlobalRateLimitAction : public Action<Ts...> {
+public:
+    explicit SyslogSetGlobalRateLimitAction(SyslogComponent *parent) : parent_(parent) {}
+    TEMPLATABLE_VALUE(float, rate)
+    TEMPLATABLE_VALUE(float, burst)
+    void play(Ts... x) override {
+        this->parent_->set_global_rate_limit(this->rate_.value(x...), this->burst_.value(x...));
+    }
+protected:
+    SyslogComponent *parent_;
+};
+
 }  // namespace syslog
 }  // namespace esphome
 #endif
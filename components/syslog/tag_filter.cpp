@@ -0,0 +1,166 @@
+// components/syslog/tag_filter.cpp
+
+#include "tag_filter.h"
+
+#include <cctype>
+
+namespace esphome {
+namespace syslog {
+
+// Case-insensitive check for the "all" keyword
+static bool is_all_keyword(const char *str, size_t len) {
+    return len == 3 && tolower(str[0]) == 'a' && tolower(str[1]) == 'l' && tolower(str[2]) == 'l';
+}
+
+TagFilter TagFilter::compile(const std::vector<std::string> &patterns, bool include_mode) {
+    TagFilter filter;
+    filter.clear(include_mode);
+    for (const auto &pattern : patterns) {
+        filter.add(pattern.data(), pattern.size());
+    }
+    filter.finish();
+    return filter;
+}
+
+void TagFilter::reserve(size_t nodes) {
+    this->max_nodes_ = nodes < NO_NODE ? nodes : NO_NODE;
+    this->nodes_.reserve(this->max_nodes_);
+}
+
+void TagFilter::clear(bool include_mode) {
+    this->nodes_.clear();
+    this->nodes_.push_back(Node{0, 0, NO_NODE, NO_NODE});
+    this->mode_ = Mode::ALL;
+    this->include_mode_ = include_mode;
+    this->has_positive_ = false;
+    this->has_negative_ = false;
+}
+
+bool TagFilter::add(const char *pattern, size_t len) {
+    bool negated = len > 0 && pattern[0] == '!';
+    if (negated) {
+        pattern++;
+        len--;
+    }
+    if (len == 0) {
+        return true;
+    }
+
+    // "all" and a trailing '*' are both prefix patterns ("all" being the empty prefix)
+    bool prefix = false;
+    if (is_all_keyword(pattern, len)) {
+        len = 0;
+        prefix = true;
+    } else if (pattern[len - 1] == '*') {
+        len--;
+        prefix = true;
+    }
+
+    uint8_t flag;
+    if (prefix) {
+        flag = negated ? FLAG_PREFIX_NEGATED : FLAG_PREFIX;
+    } else {
+        flag = negated ? FLAG_EXACT_NEGATED : FLAG_EXACT;
+    }
+    if (!this->insert_(pattern, len, flag)) {
+        return false;
+    }
+
+    if (negated) {
+        this->has_negative_ = true;
+    } else {
+        this->has_positive_ = true;
+    }
+    return true;
+}
+
+void TagFilter::finish() {
+    // Resolve lists whose outcome doesn't depend on the tag
+    bool matches_nothing = !this->has_positive_ && !this->has_negative_;
+    bool matches_everything = (this->nodes_[0].flags & FLAG_PREFIX) && !this->has_negative_;
+    if (matches_nothing) {
+        this->mode_ = this->include_mode_ ? Mode::NONE : Mode::ALL;
+    } else if (matches_everything) {
+        this->mode_ = this->include_mode_ ? Mode::ALL : Mode::NONE;
+    } else {
+        this->mode_ = Mode::MATCH;
+    }
+}
+
+bool TagFilter::insert_(const char *pattern, size_t len, uint8_t flag) {
+    uint16_t index = 0;
+    for (size_t i = 0; i < len; i++) {
+        char c = pattern[i];
+        uint16_t child = this->nodes_[index].first_child;
+        while (child != NO_NODE && this->nodes_[child].c != c) {
+            child = this->nodes_[child].next_sibling;
+        }
+
+        if (child == NO_NODE) {
+            // Out of nodes, ignore the pattern rather than corrupting the trie. Nodes added for
+            // its first characters stay behind without flags, they never match anything.
+            if (this->nodes_.size() >= this->max_nodes_) {
+                return false;
+            }
+            child = static_cast<uint16_t>(this->nodes_.size());
+            this->nodes_.push_back(Node{c, 0, NO_NODE, this->nodes_[index].first_child});
+            this->nodes_[index].first_child = child;
+        }
+        index = child;
+    }
+    this->nodes_[index].flags |= flag;
+    return true;
+}
+
+int TagFilter::match_(const char *tag) const {
+    const uint8_t prefix_flags = FLAG_PREFIX | FLAG_PREFIX_NEGATED;
+    uint8_t found = this->nodes_[0].flags & prefix_flags;
+
+    // Walk the component name (tag up to the first ':'), collecting prefix patterns on the way
+    uint16_t index = 0;
+    const char *p = tag;
+    for (; *p != '\0' && *p != ':'; p++) {
+        uint16_t child = this->nodes_[index].first_child;
+        while (child != NO_NODE && this->nodes_[child].c != *p) {
+            child = this->nodes_[child].next_sibling;
+        }
+        if (child == NO_NODE) {
+            index = NO_NODE;
+            break;
+        }
+        index = child;
+        found |= this->nodes_[index].flags & prefix_flags;
+    }
+
+    // Exact patterns only count if the whole component name was consumed
+    if (index != NO_NODE) {
+        found |= this->nodes_[index].flags & (FLAG_EXACT | FLAG_EXACT_NEGATED);
+    }
+
+    if (found & (FLAG_EXACT_NEGATED | FLAG_PREFIX_NEGATED)) {
+        return -1;
+    }
+    if (found & (FLAG_EXACT | FLAG_PREFIX)) {
+        return 1;
+    }
+    return 0;
+}
+
+bool TagFilter::should_send(const char *tag) const {
+    switch (this->mode_) {
+        case Mode::ALL:
+            return true;
+        case Mode::NONE:
+            return false;
+        default:
+            break;
+    }
+
+    // A list made only of negations matches every tag it doesn't negate
+    int match = this->match_(tag);
+    bool matched = match > 0 || (match == 0 && !this->has_positive_);
+    return this->include_mode_ ? matched : !matched;
+}
+
+}  // namespace syslog
+}  // namespace esphome
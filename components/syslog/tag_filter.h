@@ -0,0 +1,89 @@
+// components/syslog/tag_filter.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace syslog {
+
+/**
+ * @brief Compiled, immutable matcher for the tag filter list
+ *
+ * Supported patterns (matched against the component name, i.e. the tag up to the first ':'):
+ *   wifi      exact component name
+ *   sensor*   any component name starting with "sensor"
+ *   !wifi     negation, never matches even if a positive pattern does
+ *   all / *   every component
+ *
+ * A list that only contains negations behaves as if "all" was also given.
+ * Patterns are compiled into a flat trie, so evaluating a tag takes time
+ * proportional to its length and never allocates.
+ */
+class TagFilter {
+    public:
+        /**
+         * @brief Precomputed result for filter lists that don't depend on the tag
+         */
+        enum class Mode : uint8_t {
+            ALL,        // Every tag is sent
+            NONE,       // No tag is sent
+            MATCH       // The trie decides
+        };
+
+        TagFilter() = default;
+
+        // Build a matcher from the filter list and the include/exclude mode
+        static TagFilter compile(const std::vector<std::string> &patterns, bool include_mode);
+
+        // Rebuilding in place: clear(), add() every pattern, then finish(). The node storage is
+        // kept, so a filter whose nodes were reserved is rebuilt without allocating.
+        void clear(bool include_mode);
+        // Returns false if the pattern needs more nodes than were reserved
+        bool add(const char *pattern, size_t len);
+        void finish();
+
+        // Allocate room for nodes trie nodes; a pattern of n characters needs at most n of them,
+        // plus one root per filter. Patterns that need more are rejected from then on.
+        void reserve(size_t nodes);
+        // Bytes held on the heap
+        size_t allocated_bytes() const { return this->nodes_.capacity() * sizeof(Node); }
+
+        // Whether a message with this tag should be sent
+        bool should_send(const char *tag) const;
+
+        Mode get_mode() const { return this->mode_; }
+
+    protected:
+        // Pattern flags stored on trie nodes
+        static const uint8_t FLAG_EXACT = 1 << 0;
+        static const uint8_t FLAG_EXACT_NEGATED = 1 << 1;
+        static const uint8_t FLAG_PREFIX = 1 << 2;
+        static const uint8_t FLAG_PREFIX_NEGATED = 1 << 3;
+
+        static const uint16_t NO_NODE = 0xFFFF;
+
+        struct Node {
+            char c;                 // Character leading to this node
+            uint8_t flags;          // Patterns ending at this node
+            uint16_t first_child;   // Index of the first child or NO_NODE
+            uint16_t next_sibling;  // Index of the next sibling or NO_NODE
+        };
+
+        bool insert_(const char *pattern, size_t len, uint8_t flag);
+        // Returns 1 for a positive match, -1 for a negated match and 0 for no match
+        int match_(const char *tag) const;
+
+        std::vector<Node> nodes_;       // nodes_[0] is the root
+        size_t max_nodes_ = NO_NODE;    // Set by reserve()
+        Mode mode_ = Mode::ALL;
+        bool include_mode_ = false;     // Send matching tags (true) or non-matching tags (false)
+        bool has_positive_ = false;     // Whether any non-negated pattern exists
+        bool has_negative_ = false;     // Whether any negated pattern exists
+};
+
+}  // namespace syslog
+}  // namespace esphome
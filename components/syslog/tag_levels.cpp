@@ -0,0 +1,91 @@
+// components/syslog/tag_levels.cpp
+
+#include "tag_levels.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace syslog {
+
+void TagLevels::set_table(const Entry *table, size_t count) {
+    this->table_ = table;
+    this->count_ = count;
+    this->update_max_level_();
+}
+
+bool TagLevels::set_override(const char *tag, uint8_t level) {
+    if (strlen(tag) > SYSLOG_MAX_OVERRIDE_TAG_LENGTH) {
+        return false;
+    }
+
+    Override *slot = nullptr;
+    for (auto &entry : this->overrides_) {
+        if (entry.used && strcmp(entry.tag, tag) == 0) {
+            slot = &entry;
+            break;
+        }
+        if (!entry.used && slot == nullptr) {
+            slot = &entry;
+        }
+    }
+    if (slot == nullptr) {
+        return false;
+    }
+
+    strcpy(slot->tag, tag);
+    slot->level = level;
+    slot->used = true;
+    this->update_max_level_();
+    return true;
+}
+
+void TagLevels::clear_override(const char *tag) {
+    for (auto &entry : this->overrides_) {
+        if (entry.used && strcmp(entry.tag, tag) == 0) {
+            entry.used = false;
+        }
+    }
+    this->update_max_level_();
+}
+
+int TagLevels::find(const char *tag) const {
+    for (const auto &entry : this->overrides_) {
+        if (entry.used && strcmp(entry.tag, tag) == 0) {
+            return entry.level;
+        }
+    }
+
+    size_t low = 0;
+    size_t high = this->count_;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int cmp = strcmp(this->table_[mid].tag, tag);
+        if (cmp == 0) {
+            return this->table_[mid].level;
+        }
+        if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+void TagLevels::update_max_level_() {
+    int max_level = -1;
+    for (size_t i = 0; i < this->count_; i++) {
+        if (this->table_[i].level > max_level) {
+            max_level = this->table_[i].level;
+        }
+    }
+    for (const auto &entry : this->overrides_) {
+        if (entry.used && entry.level > max_level) {
+            max_level = entry.level;
+        }
+    }
+    this->max_level_ = max_level;
+}
+
+}  // namespace syslog
+}  // namespace esphome
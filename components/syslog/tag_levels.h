@@ -0,0 +1,65 @@
+// components/syslog/tag_levels.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace syslog {
+
+// Tags whose level can be changed at runtime on top of the compiled table
+static const size_t SYSLOG_MAX_LEVEL_OVERRIDES = 8;
+
+// Longest tag a runtime override can hold
+static const size_t SYSLOG_MAX_OVERRIDE_TAG_LENGTH = 31;
+
+/**
+ * @brief Per-tag minimum levels for logger messages
+ *
+ * The levels from the configuration come as a table generated at compile
+ * time, sorted by tag, and are found with a binary search. Runtime overrides
+ * are copied into a fixed number of slots and take precedence, so changing a
+ * level never allocates. Tags are matched exactly, like the logger's own
+ * per-tag levels.
+ */
+class TagLevels {
+    public:
+        /**
+         * @brief One configured tag and its minimum level
+         */
+        struct Entry {
+            const char *tag;
+            uint8_t level;
+        };
+
+        // Use a table sorted by tag (strcmp order); it must outlive the object
+        void set_table(const Entry *table, size_t count);
+
+        // Override the level of a tag; returns false if all override slots are taken or the tag is too long
+        bool set_override(const char *tag, uint8_t level);
+        // Go back to the compiled level (or the global one) for a tag
+        void clear_override(const char *tag);
+
+        // Minimum level for the tag, -1 if neither an override nor the table has one
+        int find(const char *tag) const;
+        // Highest level any tag allows, -1 if there are none
+        int get_max_level() const { return this->max_level_; }
+
+    protected:
+        struct Override {
+            char tag[SYSLOG_MAX_OVERRIDE_TAG_LENGTH + 1];
+            uint8_t level;
+            bool used;
+        };
+
+        void update_max_level_();
+
+        const Entry *table_ = nullptr;
+        size_t count_ = 0;
+        Override overrides_[SYSLOG_MAX_LEVEL_OVERRIDES] = {};
+        int max_level_ = -1;
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,185 @@
+// components/syslog/tcp_transport.cpp
+
+#include "tcp_transport.h"
+
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+#include <lwip/ip.h>
+#define IPPROTO_TCP IP_PROTO_TCP
+#endif
+
+namespace esphome {
+namespace syslog {
+
+// A closed peer must show up as a failed write, not as SIGPIPE
+#ifdef MSG_NOSIGNAL
+static const int SYSLOG_TCP_SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SYSLOG_TCP_SEND_FLAGS = 0;
+#endif
+
+bool TcpTransport::init(size_t buffer_size) {
+    if (this->is_initialized()) {
+        return true;
+    }
+    this->buffer_.reset(new (std::nothrow) char[buffer_size]);
+    if (!this->buffer_) {
+        return false;
+    }
+    this->capacity_ = buffer_size;
+    return true;
+}
+
+void TcpTransport::set_address(const struct sockaddr_storage &address, socklen_t socklen) {
+    if (socklen == this->socklen_ && (socklen == 0 || memcmp(&address, &this->address_, socklen) == 0)) {
+        return;
+    }
+    this->close();
+    this->address_ = address;
+    this->socklen_ = socklen;
+    // A new server is tried right away, whatever the backoff was for the old one
+    this->backoff_ms_ = 0;
+}
+
+void TcpTransport::close() {
+    this->socket_.reset();
+    this->state_ = State::DISCONNECTED;
+    // Frames written completely are gone; the one cut off is sent again from its start
+    this->sent_ = this->frame_start_;
+}
+
+void TcpTransport::loop(uint32_t now) {
+    if (!this->is_initialized() || this->socklen_ == 0) {
+        return;
+    }
+
+    if (this->state_ == State::DISCONNECTED) {
+        if (now - this->failed_at_ >= this->backoff_ms_) {
+            this->connect_(now);
+        }
+        return;
+    }
+
+    if (this->state_ == State::CONNECTING) {
+        // A refused or unreachable connect is reported through SO_ERROR
+        int error = 0;
+        socklen_t error_len = sizeof(error);
+        if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &error, &error_len) != 0 || error != 0) {
+            this->fail_(now);
+            return;
+        }
+        // Without select(), getpeername() only succeeding once connected tells the two apart
+        struct sockaddr_storage peer;
+        socklen_t peer_len = sizeof(peer);
+        if (this->socket_->getpeername(reinterpret_cast<struct sockaddr *>(&peer), &peer_len) == 0) {
+            this->state_ = State::CONNECTED;
+            this->backoff_ms_ = 0;
+        } else if (now - this->connect_started_ >= SYSLOG_TCP_CONNECT_TIMEOUT) {
+            this->fail_(now);
+        }
+    }
+}
+
+void TcpTransport::connect_(uint32_t now) {
+    this->socket_ = socket::socket(this->address_.ss_family, SOCK_STREAM, IPPROTO_TCP);
+    if (!this->socket_ || this->socket_->setblocking(false) != 0) {
+        this->fail_(now);
+        return;
+    }
+#ifdef TCP_NODELAY
+    // Messages are already batched into one write, don't let Nagle hold them back
+    int nodelay = 1;
+    this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+#endif
+
+    this->connect_started_ = now;
+    if (this->socket_->connect(reinterpret_cast<struct sockaddr *>(&this->address_), this->socklen_) == 0) {
+        this->state_ = State::CONNECTED;
+        this->backoff_ms_ = 0;
+    } else if (errno == EINPROGRESS) {
+        this->state_ = State::CONNECTING;
+    } else {
+        this->fail_(now);
+    }
+}
+
+void TcpTransport::fail_(uint32_t now) {
+    this->close();
+    this->failures_++;
+    this->failed_at_ = now;
+    this->backoff_ms_ = this->backoff_ms_ == 0 ? SYSLOG_TCP_BACKOFF_MIN
+                                              : std::min(this->backoff_ms_ * 2, SYSLOG_TCP_BACKOFF_MAX);
+}
+
+bool TcpTransport::can_frame(size_t len) const {
+    // Frames already written completely make room once the buffer is compacted
+    return len + SYSLOG_TCP_FRAME_OVERHEAD <= this->capacity_ - (this->length_ - this->frame_start_);
+}
+
+bool TcpTransport::frame(const char *data, size_t len) {
+    if (!this->is_initialized() || !this->can_frame(len)) {
+        return false;
+    }
+
+    if (this->length_ + len + SYSLOG_TCP_FRAME_OVERHEAD > this->capacity_) {
+        memmove(this->buffer_.get(), this->buffer_.get() + this->frame_start_, this->length_ - this->frame_start_);
+        this->length_ -= this->frame_start_;
+        this->sent_ -= this->frame_start_;
+        this->frame_start_ = 0;
+    }
+
+    char *dst = this->buffer_.get() + this->length_;
+    int prefix_len = snprintf(dst, SYSLOG_TCP_FRAME_OVERHEAD + 1, "%u ", (unsigned) len);
+    memcpy(dst + prefix_len, data, len);
+    this->length_ += prefix_len + len;
+    return true;
+}
+
+void TcpTransport::flush() {
+    if (this->state_ != State::CONNECTED || this->sent_ >= this->length_) {
+        return;
+    }
+
+    // sendto() without an address is send() on a connected socket, and takes the flags write() can't
+    ssize_t written = this->socket_->sendto(this->buffer_.get() + this->sent_, this->length_ - this->sent_,
+                                            SYSLOG_TCP_SEND_FLAGS, nullptr, 0);
+    if (written < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            this->fail_(millis());
+        }
+        return;
+    }
+    this->sent_ += written;
+
+    // Skip the frames that are out completely
+    while (this->frame_start_ < this->length_) {
+        size_t end = this->frame_end_(this->frame_start_);
+        if (end > this->sent_) {
+            break;
+        }
+        this->frame_start_ = end;
+    }
+    if (this->frame_start_ == this->length_) {
+        this->length_ = 0;
+        this->frame_start_ = 0;
+        this->sent_ = 0;
+    }
+}
+
+size_t TcpTransport::frame_end_(size_t pos) const {
+    size_t len = 0;
+    while (this->buffer_[pos] != ' ') {
+        len = len * 10 + (this->buffer_[pos] - '0');
+        pos++;
+    }
+    return pos + 1 + len;
+}
+
+}  // namespace syslog
+}  // namespace esphome
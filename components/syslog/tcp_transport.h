@@ -0,0 +1,99 @@
+// components/syslog/tcp_transport.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "esphome/components/socket/socket.h"
+
+namespace esphome {
+namespace syslog {
+
+// Delay before the first reconnect attempt, doubled after every failure up to the maximum (ms)
+static const uint32_t SYSLOG_TCP_BACKOFF_MIN = 1000;
+static const uint32_t SYSLOG_TCP_BACKOFF_MAX = 60000;
+
+// How long a connect may stay in progress before it counts as failed (ms)
+static const uint32_t SYSLOG_TCP_CONNECT_TIMEOUT = 10000;
+
+// Longest octet-counting prefix: "65535 "
+static const size_t SYSLOG_TCP_FRAME_OVERHEAD = 6;
+
+/**
+ * @brief Stream connection to the server using RFC 6587 octet-counting framing
+ *
+ * Messages are appended to a preallocated buffer as "MSG-LEN SP SYSLOG-MSG"
+ * frames and flush() hands everything buffered to the socket in one write.
+ * The socket is non-blocking: connects are started and completed from loop(),
+ * failed connections are retried with exponential backoff, and a partial write
+ * leaves the rest for the next flush(). Nothing here ever waits for the peer;
+ * when the buffer is full, frame() refuses the message.
+ *
+ * If the connection drops in the middle of a frame, that frame is sent again
+ * in full on the next connection, the receiver discards the partial copy.
+ */
+class TcpTransport {
+    public:
+        enum class State : uint8_t {
+            DISCONNECTED,   // No socket, waiting for the backoff to run out
+            CONNECTING,     // Non-blocking connect in progress
+            CONNECTED
+        };
+
+        // Allocate the frame buffer (only the first call allocates)
+        bool init(size_t buffer_size);
+        bool is_initialized() const { return this->buffer_ != nullptr; }
+
+        // Connect to this address from now on; reconnects right away if it changed (socklen 0 = none yet)
+        void set_address(const struct sockaddr_storage &address, socklen_t socklen);
+        // Drop the connection; buffered frames are kept for the next one
+        void close();
+
+        // Start, complete or retry the connection; call from loop() while the network is up
+        void loop(uint32_t now);
+
+        State get_state() const { return this->state_; }
+        bool is_connected() const { return this->state_ == State::CONNECTED; }
+        // Delay before the next reconnect attempt (ms)
+        uint32_t get_retry_delay() const { return this->backoff_ms_; }
+        // Failed connects and connections lost since boot
+        uint32_t get_failure_count() const { return this->failures_; }
+
+        // Whether a message of len bytes fits in the buffer now
+        bool can_frame(size_t len) const;
+        // Append one message as a frame; returns false if it doesn't fit
+        bool frame(const char *data, size_t len);
+        // Write as much of the buffered frames as the socket takes, with a single write
+        void flush();
+        bool has_pending() const { return this->length_ > 0; }
+        // Bytes allocated by init()
+        size_t allocated_bytes() const { return this->capacity_; }
+
+    protected:
+        // Create the socket and start a non-blocking connect
+        void connect_(uint32_t now);
+        // Close the socket after a failure and schedule the next attempt
+        void fail_(uint32_t now);
+        // Offset just past the frame starting at pos
+        size_t frame_end_(size_t pos) const;
+
+        std::unique_ptr<socket::Socket> socket_;
+        struct sockaddr_storage address_;
+        socklen_t socklen_ = 0;
+        State state_ = State::DISCONNECTED;
+        uint32_t connect_started_ = 0;          // millis() when the running connect was started
+        uint32_t failed_at_ = 0;                // millis() of the last failure
+        uint32_t backoff_ms_ = 0;               // Wait after failed_at_ before reconnecting (0 = right away)
+        uint32_t failures_ = 0;
+
+        std::unique_ptr<char[]> buffer_;        // Frames waiting to be written
+        size_t capacity_ = 0;
+        size_t length_ = 0;                     // Bytes used in buffer_
+        size_t frame_start_ = 0;                // Start of the first frame not written completely
+        size_t sent_ = 0;                       // Bytes of buffer_ already written
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,114 @@
+// tests/ansi_strip_test.h
+//
+// Corpus test for host_ansi_strip_test.yaml: strip_ansi() on real ESPHome
+// logger output, as the logger hands it to the component's callback.
+
+#pragma once
+
+#include <cstring>
+#include <string>
+
+#include "test_support.h"
+#include "esphome/components/syslog/ansi_strip.h"
+
+namespace ansi_strip_test {
+
+using namespace syslog_test;
+
+struct Case {
+    const char *input;
+    const char *expected;
+    bool view;  // Whether the stripped text is a single run, returned without copying
+};
+
+// Logger output of ESPHome 2023.x-2025.x: "\033[<bold>;<color>m[L][tag:line]: text\033[0m",
+// with secrets wrapped in blink/unblink codes by the config dumps
+static const Case CORPUS[] = {
+    // One line per level, with the logger's colors
+    {"\033[1;31m[E][wifi:1160]: Connection failed\033[0m", "[E][wifi:1160]: Connection failed", true},
+    {"\033[0;33m[W][component:237]: Component api took a long time for an operation (54 ms).\033[0m",
+     "[W][component:237]: Component api took a long time for an operation (54 ms).", true},
+    {"\033[0;32m[I][app:100]: ESPHome version 2024.12.2 compiled on Jan  6 2025, 10:02:11\033[0m",
+     "[I][app:100]: ESPHome version 2024.12.2 compiled on Jan  6 2025, 10:02:11", true},
+    {"\033[0;35m[C][logger:185]: Logger:\033[0m", "[C][logger:185]: Logger:", true},
+    {"\033[0;36m[D][sensor:094]: 'Living Room Temperature': Sending state 21.43750 \xC2\xB0" "C with 1 decimals of accuracy\033[0m",
+     "[D][sensor:094]: 'Living Room Temperature': Sending state 21.43750 \xC2\xB0" "C with 1 decimals of accuracy", true},
+    {"\033[0;37m[V][api.connection:1375]: Sending keepalive PING\033[0m",
+     "[V][api.connection:1375]: Sending keepalive PING", true},
+    {"\033[0;38m[VV][api.service:042]: send_message ping_request: PingRequest {}\033[0m",
+     "[VV][api.service:042]: send_message ping_request: PingRequest {}", true},
+
+    // ESP32 builds name the task the message was logged from
+    {"\033[0;36m[D][ble_client:110][BTU_TASK]: Connected to 24:0A:C4:00:00:01\033[0m",
+     "[D][ble_client:110][BTU_TASK]: Connected to 24:0A:C4:00:00:01", true},
+
+    // Config dumps hide secrets between blink (5) and unblink (6) codes
+    {"\033[0;35m[C][wifi:443]:   SSID: \033[5m'home-network'\033[6m\033[0m",
+     "[C][wifi:443]:   SSID: 'home-network'", false},
+    {"\033[0;35m[C][wifi:444]:   IP Address: 192.168.1.23\033[0m", "[C][wifi:444]:   IP Address: 192.168.1.23", true},
+    {"\033[0;35m[C][mqtt:052]:   Username: \033[5m'esphome'\033[6m\033[0m",
+     "[C][mqtt:052]:   Username: 'esphome'", false},
+    {"\033[0;35m[C][api:140]:   Using noise encryption: YES\033[0m", "[C][api:140]:   Using noise encryption: YES", true},
+
+    // Multi-line messages keep their line breaks
+    {"\033[0;35m[C][template.sensor:022]: Template Sensor 'Uptime'\n  State Class: 'measurement'\n"
+     "  Unit of Measurement: 's'\n  Accuracy Decimals: 0\033[0m",
+     "[C][template.sensor:022]: Template Sensor 'Uptime'\n  State Class: 'measurement'\n"
+     "  Unit of Measurement: 's'\n  Accuracy Decimals: 0", true},
+
+    // Colors and bold inside the text, as some components log them
+    {"\033[0;32m[I][ota:117]: Boot seems successful, \033[1;32mresetting boot loop counter\033[0;32m.\033[0m",
+     "[I][ota:117]: Boot seems successful, resetting boot loop counter.", false},
+    {"\033[0;36m[D][light:036]: 'Desk' Setting:\033[0m\n\033[0;36m  Brightness: 100%\033[0m",
+     "[D][light:036]: 'Desk' Setting:\n  Brightness: 100%", false},
+
+    // Without colors (logger hardware_uart output captured elsewhere, or color stripped upstream)
+    {"[I][app:100]: ESPHome version 2025.2.0", "[I][app:100]: ESPHome version 2025.2.0", true},
+    {"", "", true},
+
+    // 256-color and true-color SGR, cursor movement and erase
+    {"\033[38;5;208m[W][dallas.sensor:280]: Requesting conversion failed\033[0m",
+     "[W][dallas.sensor:280]: Requesting conversion failed", true},
+    {"\033[38;2;255;128;0m[I][status:042]: ok\033[m", "[I][status:042]: ok", true},
+    {"\033[2K\033[1G[I][progress:010]: 42%", "[I][progress:010]: 42%", true},
+
+    // Other escapes: OSC window title with BEL or ST, a two-byte escape, a charset designation
+    {"\033]0;esphome-node\007[I][app:100]: title set", "[I][app:100]: title set", true},
+    {"\033]0;esphome-node\033\\[I][app:100]: title set", "[I][app:100]: title set", true},
+    {"\033c[I][app:100]: reset", "[I][app:100]: reset", true},
+    {"\033(B[I][app:100]: ascii", "[I][app:100]: ascii", true},
+
+    // Truncated by the logger's buffer in the middle of the reset code
+    {"\033[0;36m[D][uart_debug:158]: <<< 01 03 00 00\033[", "[D][uart_debug:158]: <<< 01 03 00 00", true},
+    {"\033[0;36m[D][uart_debug:158]: <<< 01 03 00 00\033", "[D][uart_debug:158]: <<< 01 03 00 00", true},
+
+    // Only escapes
+    {"\033[0m", "", true},
+    {"\033[0;35m\033[0m", "", true},
+};
+
+static int run() {
+    char scratch[512];
+    int index = 0;
+    for (const Case &test : CORPUS) {
+        const char *out = nullptr;
+        size_t len = esphome::syslog::strip_ansi(test.input, strlen(test.input), scratch, sizeof(scratch), &out);
+        std::string got(out, len);
+        check(got == test.expected, "case %d: got \"%s\", expected \"%s\"", index, got.c_str(), test.expected);
+        if (test.view) {
+            bool in_input = out >= test.input && out + len <= test.input + strlen(test.input);
+            check(in_input, "case %d: expected a view into the input, got a copy", index);
+        }
+        index++;
+    }
+
+    // A copy that doesn't fit in the scratch buffer is truncated to it
+    const char *input = "\033[0;35m[C][wifi:443]:   SSID: \033[5m'home-network'\033[6m\033[0m";
+    const char *out = nullptr;
+    size_t len = esphome::syslog::strip_ansi(input, strlen(input), scratch, 10, &out);
+    check(len == 10 && std::string(out, len) == "[C][wifi:4", "truncated copy: got %u bytes \"%.*s\"",
+          (unsigned) len, (int) len, out);
+    return finish("ansi_strip");
+}
+
+}  // namespace ansi_strip_test
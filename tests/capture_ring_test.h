@@ -0,0 +1,179 @@
+// tests/capture_ring_test.h
+//
+// Test for host_capture_ring_test.yaml, built with ThreadSanitizer: threads log
+// through the logger callback and log() while the loop thread sends and swaps
+// the filter string. Every message is accounted for exactly: received once,
+// filtered, or counted as dropped by the capture ring. Levels nothing accepts
+// don't take ring slots, and messages carry the time they were captured.
+
+#pragma once
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_support.h"
+
+namespace capture_ring_test {
+
+using namespace syslog_test;
+
+static const uint16_t PORT = 5541;
+static const char *const NOISE_TAG = "noise";     // Excluded by every other filter string
+static const int PRODUCERS = 8;
+static const int MESSAGES_PER_PRODUCER = 1000;    // Each logs this many probes of each kind, and as much noise
+static const int VERBOSE_MESSAGES = 200;          // Per producer, several times the ring's capacity in total
+static const uint32_t PRODUCE_INTERVAL_US = 1000; // Producers pause between rounds, so most messages get through
+static const uint32_t FILTER_SWAP_INTERVAL_MS = 3;
+static const uint32_t SETTLE_TIME_MS = 200;
+static const uint32_t STAMP_DELAY_MS = 500;       // Time a captured message waits before the loop picks it up
+static const uint32_t STAMP_TOLERANCE_MS = 100;
+
+// Markers of every probe and noise line the receiver got, in arrival order
+struct Received {
+    std::vector<std::string> probes;
+    size_t noise = 0;
+};
+
+static void collect(Receiver &receiver, Received *received) {
+    for (const auto &datagram : receive_all(receiver)) {
+        size_t start = datagram.find("probe=");
+        if (start != std::string::npos) {
+            received->probes.push_back(datagram.substr(start, datagram.find(';', start) - start));
+        } else if (datagram.find("noise=") != std::string::npos) {
+            received->noise++;
+        } else {
+            check(datagram.find("verbose=") == std::string::npos, "received a VERBOSE message");
+        }
+    }
+}
+
+static void produce(esphome::syslog::SyslogComponent *syslog, int id, std::atomic<int> *running) {
+    for (int i = 0; i < MESSAGES_PER_PRODUCER; i++) {
+        ESP_LOGD(TEST_TAG, "probe=L%d-%d;", id, i);
+        syslog->log(ESPHOME_LOG_LEVEL_DEBUG, "direct", "probe=D" + std::to_string(id) + "-" + std::to_string(i) + ";");
+        ESP_LOGD(NOISE_TAG, "noise=%d-%d;", id, i);
+        ESP_LOGV(TEST_TAG, "verbose=%d-%d;", id, i);
+        usleep(PRODUCE_INTERVAL_US);
+    }
+    running->fetch_sub(1);
+}
+
+static void flood_verbose() {
+    for (int i = 0; i < VERBOSE_MESSAGES; i++) {
+        ESP_LOGV(TEST_TAG, "verbose=%d;", i);
+    }
+}
+
+// Messages above every destination's level don't take ring slots, even while the loop isn't running
+static void check_verbose_flood(esphome::syslog::SyslogComponent *syslog, Receiver &receiver) {
+    uint32_t dropped_before = syslog->get_capture_dropped_count();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < PRODUCERS; i++) {
+        threads.emplace_back(flood_verbose);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    uint32_t dropped = syslog->get_capture_dropped_count() - dropped_before;
+    check(dropped == 0, "%u VERBOSE messages dropped by the capture ring", (unsigned) dropped);
+    pump(syslog, SETTLE_TIME_MS);
+    Received received;
+    collect(receiver, &received);
+}
+
+// sysUpTime is the time the message was pushed to the ring, not the time loop() formatted it
+static void check_capture_time(esphome::syslog::SyslogComponent *syslog, Receiver &receiver) {
+    uint32_t before = esphome::millis();
+    std::thread([] { ESP_LOGI(TEST_TAG, "probe=stamp;"); }).join();
+    uint32_t after = esphome::millis();
+    usleep(STAMP_DELAY_MS * 1000);
+    pump(syslog, SETTLE_TIME_MS);
+
+    unsigned uptime = 0;
+    bool found = false;
+    for (const auto &datagram : receive_all(receiver)) {
+        if (datagram.find("probe=stamp;") != std::string::npos) {
+            size_t pos = datagram.find("sysUpTime=\"");
+            found = pos != std::string::npos && sscanf(datagram.c_str() + pos, "sysUpTime=\"%u\"", &uptime) == 1;
+        }
+    }
+    check(found, "no sysUpTime on the message logged from another thread");
+    uint32_t stamp = uptime * 10;
+    check(found && stamp + 10 >= before && stamp <= after + STAMP_TOLERANCE_MS,
+          "sysUpTime %u ms, captured between %u and %u ms", (unsigned) stamp, (unsigned) before, (unsigned) after);
+}
+
+static int run(esphome::syslog::SyslogComponent *syslog) {
+    Receiver receiver;
+    check(receiver.open(PORT), "bind port %u", (unsigned) PORT);
+    if (failures > 0) {
+        return finish("capture_ring");
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    receiver.drain();
+
+    check_verbose_flood(syslog, receiver);
+    check_capture_time(syslog, receiver);
+
+    // Producers log while the loop thread sends and swaps the filter string under them
+    uint32_t captured_before = syslog->get_stats().captured;
+    uint32_t filtered_before = syslog->get_stats().filtered;
+    uint32_t ring_dropped_before = syslog->get_capture_dropped_count();
+    uint32_t queue_dropped_before = syslog->get_dropped_count();
+    std::atomic<int> running{PRODUCERS};
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCERS; i++) {
+        producers.emplace_back(produce, syslog, i, &running);
+    }
+    Received received;
+    bool excluding = false;
+    uint32_t last_swap = esphome::millis();
+    while (running.load() > 0) {
+        syslog->loop();
+        collect(receiver, &received);
+        if (esphome::millis() - last_swap >= FILTER_SWAP_INTERVAL_MS) {
+            excluding = !excluding;
+            syslog->set_filter_string(excluding ? NOISE_TAG : "");
+            last_swap = esphome::millis();
+        }
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    syslog->set_filter_string("");
+    uint32_t start = esphome::millis();
+    while (esphome::millis() - start < SETTLE_TIME_MS) {
+        syslog->loop();
+        collect(receiver, &received);
+        usleep(1000);
+    }
+
+    std::set<std::string> unique(received.probes.begin(), received.probes.end());
+    check(unique.size() == received.probes.size(), "%u probes received more than once",
+          (unsigned) (received.probes.size() - unique.size()));
+    uint32_t filtered = syslog->get_stats().filtered - filtered_before;
+    uint32_t ring_dropped = syslog->get_capture_dropped_count() - ring_dropped_before;
+    uint32_t queue_dropped = syslog->get_dropped_count() - queue_dropped_before;
+    uint32_t captured = syslog->get_stats().captured - captured_before;
+    check(queue_dropped == 0, "%u messages dropped by the send queue", (unsigned) queue_dropped);
+
+    // Only noise is filtered, and every message the ring didn't drop reached the loop thread
+    const uint32_t pushed = PRODUCERS * MESSAGES_PER_PRODUCER * 3;
+    uint32_t accounted = unique.size() + received.noise + filtered + ring_dropped;
+    check(accounted == pushed, "%u pushed, %u accounted for: %u probes, %u noise received, %u filtered, %u dropped",
+          (unsigned) pushed, (unsigned) accounted, (unsigned) unique.size(), (unsigned) received.noise,
+          (unsigned) filtered, (unsigned) ring_dropped);
+    check(captured >= pushed - ring_dropped, "%u captured by the loop thread, expected at least %u", (unsigned) captured,
+          (unsigned) (pushed - ring_dropped));
+    check(unique.size() > 0 && received.noise > 0 && filtered > 0, "%u probes and %u noise lines received, %u filtered",
+          (unsigned) unique.size(), (unsigned) received.noise, (unsigned) filtered);
+    fprintf(stderr, "capture_ring: %u pushed, %u probes and %u noise received, %u filtered, %u dropped by the ring\n",
+            (unsigned) pushed, (unsigned) unique.size(), (unsigned) received.noise, (unsigned) filtered,
+            (unsigned) ring_dropped);
+    return finish("capture_ring");
+}
+
+}  // namespace capture_ring_test
@@ -0,0 +1,61 @@
+// tests/outage_order_test.h
+//
+// Test for host_outage_order_test.yaml: while the main server's hostname is
+// unresolved, urgent and bulk messages move to the outage buffer in the order
+// they were logged, and are replayed in that order once the server resolves.
+
+#pragma once
+
+#include <string>
+
+#include "test_support.h"
+
+namespace outage_order_test {
+
+using namespace syslog_test;
+
+static const uint16_t PORT = 5551;
+static const uint32_t SETTLE_TIME_MS = 100;
+static const int PROBES = 12;
+
+static int run(esphome::syslog::SyslogComponent *syslog) {
+    Receiver receiver;
+    check(receiver.open(PORT), "bind port %u", (unsigned) PORT);
+    if (failures > 0) {
+        return finish("outage_order");
+    }
+
+    // Every third message is urgent; none of them can be sent yet
+    uint32_t dropped_before = syslog->get_dropped_count();
+    for (int i = 0; i < PROBES; i++) {
+        if (i % 3 == 1) {
+            ESP_LOGW(TEST_TAG, "probe=%d;", i);
+        } else {
+            ESP_LOGD(TEST_TAG, "probe=%d;", i);
+        }
+        usleep(100);
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    check(syslog->get_dropped_count() == dropped_before, "%u messages dropped by the send queue",
+          (unsigned) (syslog->get_dropped_count() - dropped_before));
+    check(syslog->get_outage_buffered_count() >= PROBES, "%u messages in the outage buffer, expected at least %d",
+          (unsigned) syslog->get_outage_buffered_count(), PROBES);
+
+    syslog->set_server_ip("127.0.0.1");
+    pump(syslog, SETTLE_TIME_MS);
+    std::string order;
+    std::string expected;
+    for (const auto &datagram : receive_all(receiver)) {
+        size_t start = datagram.find("probe=");
+        if (start != std::string::npos) {
+            order += datagram.substr(start + 6, datagram.find(';', start) - start - 6) + " ";
+        }
+    }
+    for (int i = 0; i < PROBES; i++) {
+        expected += std::to_string(i) + " ";
+    }
+    check(order == expected, "replayed in the order \"%s\", expected \"%s\"", order.c_str(), expected.c_str());
+    return finish("outage_order");
+}
+
+}  // namespace outage_order_test
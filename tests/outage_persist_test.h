@@ -0,0 +1,83 @@
+// tests/outage_persist_test.h
+//
+// Test for host_outage_persist_test.yaml: an outage buffer larger than the
+// part kept in flash is saved and restored as after a reboot. The newest
+// records are restored, and every message that isn't restored is counted in
+// the lost marker.
+
+#pragma once
+
+#include <string>
+
+#include "test_support.h"
+
+namespace outage_persist_test {
+
+using namespace syslog_test;
+
+static const uint32_t SETTLE_TIME_MS = 100;
+static const int PROBES = 400;  // Well over the 16384 byte buffer, which is over the 4096 bytes kept in flash
+
+// Reaches the protected save and load steps through member pointers named by a derived class
+struct Access : esphome::syslog::SyslogComponent {
+    static esphome::syslog::OutageBuffer &outage(esphome::syslog::SyslogComponent *syslog) {
+        return syslog->*(&Access::outage_);
+    }
+    static void save(esphome::syslog::SyslogComponent *syslog) { (syslog->*(&Access::save_outage_))(true); }
+    static void load(esphome::syslog::SyslogComponent *syslog) { (syslog->*(&Access::load_outage_))(); }
+};
+
+// Number in the probe=N; marker of a datagram, -1 if there is none
+static int probe_number(const char *data, size_t len) {
+    std::string datagram(data, len);
+    size_t start = datagram.find("probe=");
+    return start == std::string::npos ? -1 : atoi(datagram.c_str() + start + 6);
+}
+
+static int run(esphome::syslog::SyslogComponent *syslog) {
+    // Nothing can be sent while the server is unresolved, so every probe goes to the outage buffer;
+    // ERROR messages take the small urgent lane, so each one is moved there before the next
+    // Startup messages go to the outage buffer first, so only probes are counted
+    esphome::syslog::OutageBuffer &outage = Access::outage(syslog);
+    pump(syslog, SETTLE_TIME_MS);
+    outage.clear();
+    outage.take_lost_count();
+    for (int i = 0; i < PROBES; i++) {
+        ESP_LOGE(TEST_TAG, "probe=%d; padding the message to the length of a typical sensor log line", i);
+        syslog->loop();
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    check(outage.used_bytes() > SYSLOG_OUTAGE_PERSIST_SIZE, "%u bytes in the outage buffer, expected more than %u",
+          (unsigned) outage.used_bytes(), (unsigned) SYSLOG_OUTAGE_PERSIST_SIZE);
+    check(outage.get_lost_count() + outage.size() == PROBES, "%u lost and %u buffered, %d logged",
+          (unsigned) outage.get_lost_count(), (unsigned) outage.size(), PROBES);
+
+    // Save, then restore into an empty buffer as setup() does after a reboot
+    Access::save(syslog);
+    outage.clear();
+    outage.take_lost_count();
+    Access::load(syslog);
+    uint32_t lost = outage.get_lost_count();
+    uint32_t restored = outage.size();
+    check(restored > 0, "nothing restored");
+    check(lost + restored == PROBES, "%u lost and %u restored, %d logged", (unsigned) lost, (unsigned) restored,
+          PROBES);
+
+    // The restored records are the newest probes, in order
+    char data[1024];
+    uint8_t destinations = 0;
+    int expected = PROBES - static_cast<int>(restored);
+    bool in_order = true;
+    while (!outage.empty()) {
+        size_t len = outage.front(data, sizeof(data), &destinations);
+        in_order &= probe_number(data, len) == expected;
+        expected++;
+        outage.pop();
+    }
+    check(in_order, "restored records aren't probes %d to %d in order", PROBES - (int) restored, PROBES - 1);
+    fprintf(stderr, "outage_persist: %d logged, %u restored, %u counted as lost\n", PROBES, (unsigned) restored,
+            (unsigned) lost);
+    return finish("outage_persist");
+}
+
+}  // namespace outage_persist_test
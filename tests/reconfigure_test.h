@@ -0,0 +1,92 @@
+// tests/reconfigure_test.h
+//
+// Regression test for host_reconfigure_test.yaml: after any number of runtime
+// destination changes and disable/enable cycles, every log line is sent exactly
+// once, and destination changes keep the existing UDP socket.
+
+#pragma once
+
+#include <string>
+
+#include "test_support.h"
+
+namespace reconfigure_test {
+
+using namespace syslog_test;
+
+static const uint16_t PORT_A = 5521;
+static const uint16_t PORT_B = 5522;
+static const int ROUNDS = 10;
+static const uint32_t SETTLE_TIME_MS = 50;
+
+// Log one probe line through the logger and check it arrives exactly once, at the receiver it is meant for
+static void probe(esphome::syslog::SyslogComponent *syslog, Receiver &expected, Receiver &other, const char *step,
+                  int round, uint16_t *source_port) {
+    char marker[48];
+    snprintf(marker, sizeof(marker), "probe=%s-%d;", step, round);
+    ESP_LOGI(TEST_TAG, "%s", marker);
+    pump(syslog, SETTLE_TIME_MS);
+
+    std::vector<std::string> datagrams;
+    std::string datagram;
+    uint16_t port = 0;
+    while (expected.receive(&datagram, &port)) {
+        datagrams.push_back(datagram);
+        if (*source_port == 0) {
+            *source_port = port;
+        }
+        if (datagram.find(marker) != std::string::npos) {
+            check(port == *source_port, "%s sent from port %u, not %u", marker, (unsigned) port,
+                  (unsigned) *source_port);
+        }
+    }
+    size_t count = count_containing(datagrams, marker);
+    check(count == 1, "%s received %u times", marker, (unsigned) count);
+    size_t stray = count_containing(receive_all(other), marker);
+    check(stray == 0, "%s also received %u times at the previous destination", marker, (unsigned) stray);
+}
+
+static int run(esphome::syslog::SyslogComponent *syslog) {
+    Receiver receiver_a;
+    Receiver receiver_b;
+    check(receiver_a.open(PORT_A), "bind port %u", (unsigned) PORT_A);
+    check(receiver_b.open(PORT_B), "bind port %u", (unsigned) PORT_B);
+    if (failures > 0) {
+        return finish("reconfigure");
+    }
+
+    syslog->set_server_ip("127.0.0.1");
+    syslog->set_server_port(PORT_A);
+    pump(syslog, SETTLE_TIME_MS);
+    receiver_a.drain();
+    receiver_b.drain();
+
+    uint16_t source_port = 0;
+    probe(syslog, receiver_a, receiver_b, "initial", 0, &source_port);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        // Port changes keep the socket, so the source port stays the same
+        syslog->set_server_port(PORT_B);
+        probe(syslog, receiver_b, receiver_a, "port-b", round, &source_port);
+        syslog->set_server_port(PORT_A);
+        probe(syslog, receiver_a, receiver_b, "port-a", round, &source_port);
+
+        // Setting the same address again is harmless
+        syslog->set_server_ip("127.0.0.1");
+        probe(syslog, receiver_a, receiver_b, "same-ip", round, &source_port);
+
+        // Re-enabling runs setup() again; it must not register another logger callback
+        syslog->set_globally_enabled(false);
+        ESP_LOGI(TEST_TAG, "probe=disabled-%d;", round);
+        pump(syslog, SETTLE_TIME_MS);
+        size_t disabled = count_containing(receive_all(receiver_a), "probe=disabled-");
+        check(disabled == 0, "%u lines sent while disabled", (unsigned) disabled);
+        syslog->set_globally_enabled(true);
+        uint16_t enabled_port = 0;  // The socket is recreated on enable, so the source port may change
+        probe(syslog, receiver_a, receiver_b, "enabled", round, &enabled_port);
+        source_port = enabled_port;
+    }
+    return finish("reconfigure");
+}
+
+}  // namespace reconfigure_test
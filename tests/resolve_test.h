@@ -0,0 +1,82 @@
+// tests/resolve_test.h
+//
+// Test for host_resolve_test.yaml: while the primary server's hostname can't
+// be resolved, an additional destination with a literal address still gets
+// every message; once the primary is changed to a name from /etc/hosts, both
+// get them.
+
+#pragma once
+
+#include <string>
+
+#include "test_support.h"
+
+namespace resolve_test {
+
+using namespace syslog_test;
+
+static const uint16_t PRIMARY_PORT = 5531;      // Port of the primary server (ip_address in the YAML)
+static const uint16_t DESTINATION_PORT = 5532;  // Port of the additional destination (127.0.0.1)
+static const char *const HOSTS_NAME = "localhost";  // Resolved by the system resolver from /etc/hosts
+static const uint32_t SETTLE_TIME_MS = 50;
+static const uint32_t RESOLVE_TIMEOUT_MS = 5000;
+static const int PROBES = 20;
+
+static int run(esphome::syslog::SyslogComponent *syslog) {
+    Receiver primary;
+    Receiver destination;
+    check(primary.open(PRIMARY_PORT, true), "bind port %u", (unsigned) PRIMARY_PORT);
+    check(destination.open(DESTINATION_PORT), "bind port %u", (unsigned) DESTINATION_PORT);
+    if (failures > 0) {
+        return finish("resolve");
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    destination.drain();
+
+    // The primary's name doesn't resolve: the destination must not wait for it
+    uint32_t unreachable_before = syslog->get_stats().unreachable;
+    for (int i = 0; i < PROBES; i++) {
+        ESP_LOGI(TEST_TAG, "probe=unresolved-%d;", i);
+        pump(syslog, 1);
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    std::vector<std::string> received = receive_all(destination);
+    for (int i = 0; i < PROBES; i++) {
+        std::string marker = "probe=unresolved-" + std::to_string(i) + ";";
+        size_t count = count_containing(received, marker);
+        check(count == 1, "%s received %u times by the destination", marker.c_str(), (unsigned) count);
+    }
+    uint32_t unreachable = syslog->get_stats().unreachable - unreachable_before;
+    check(unreachable >= PROBES, "%u datagrams counted as unreachable, expected at least %d", (unsigned) unreachable,
+          PROBES);
+    check(count_containing(receive_all(primary), "probe=unresolved-") == 0, "primary received a probe");
+
+    // A name from /etc/hosts resolves on the host platform; wait for the lookup, then both get every probe
+    syslog->set_server_ip(HOSTS_NAME);
+    bool resolved = false;
+    uint32_t start = esphome::millis();
+    while (!resolved && esphome::millis() - start < RESOLVE_TIMEOUT_MS) {
+        ESP_LOGI(TEST_TAG, "probe=resolving;");
+        pump(syslog, SETTLE_TIME_MS);
+        resolved = count_containing(receive_all(primary), "probe=resolving;") > 0;
+    }
+    check(resolved, "%s didn't resolve within %u ms", HOSTS_NAME, (unsigned) RESOLVE_TIMEOUT_MS);
+    destination.drain();
+    for (int i = 0; i < PROBES; i++) {
+        ESP_LOGI(TEST_TAG, "probe=resolved-%d;", i);
+        pump(syslog, 1);
+    }
+    pump(syslog, SETTLE_TIME_MS);
+    std::vector<std::string> at_primary = receive_all(primary);
+    std::vector<std::string> at_destination = receive_all(destination);
+    for (int i = 0; i < PROBES; i++) {
+        std::string marker = "probe=resolved-" + std::to_string(i) + ";";
+        size_t count = count_containing(at_primary, marker);
+        check(count == 1, "%s received %u times by the primary", marker.c_str(), (unsigned) count);
+        count = count_containing(at_destination, marker);
+        check(count == 1, "%s received %u times by the destination", marker.c_str(), (unsigned) count);
+    }
+    return finish("resolve");
+}
+
+}  // namespace resolve_test
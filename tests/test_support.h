@@ -0,0 +1,152 @@
+// tests/test_support.h
+//
+// Shared helpers for the host-platform tests in this folder. Each test
+// configuration includes this header and its own *_test.h, and runs the test
+// from on_boot once every component is set up. The firmware exits with status
+// 0 if every check passed and 1 otherwise.
+
+#pragma once
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/syslog/syslog_component.h"
+
+namespace syslog_test {
+
+static const char *const TEST_TAG = "test";
+
+static int checks = 0;
+static int failures = 0;
+
+inline void check(bool ok, const char *format, ...) __attribute__((format(printf, 2, 3)));
+inline void check(bool ok, const char *format, ...) {
+    checks++;
+    if (ok) {
+        return;
+    }
+    failures++;
+    char message[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    // stderr, so a failure shows up even when the logger or the component under test is broken
+    fprintf(stderr, "FAIL: %s\n", message);
+}
+
+// Report and return the exit status
+inline int finish(const char *name) {
+    fprintf(stderr, "%s: %d checks, %d failed -> %s\n", name, checks, failures, failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
+
+/**
+ * @brief UDP socket on the loopback interface standing in for the syslog server
+ */
+class Receiver {
+    public:
+        // dual_stack also receives over IPv6, for a server name that may resolve to ::1
+        bool open(uint16_t port, bool dual_stack = false) {
+            if (dual_stack) {
+                this->fd_ = ::socket(AF_INET6, SOCK_DGRAM, 0);
+                if (this->fd_ >= 0) {
+                    int v6only = 0;
+                    setsockopt(this->fd_, IPPROTO_IPV6, IPV6_V6ONLY, &v6only, sizeof(v6only));
+                    struct sockaddr_in6 addr6;
+                    memset(&addr6, 0, sizeof(addr6));
+                    addr6.sin6_family = AF_INET6;
+                    addr6.sin6_port = htons(port);
+                    addr6.sin6_addr = in6addr_any;
+                    return bind(this->fd_, reinterpret_cast<struct sockaddr *>(&addr6), sizeof(addr6)) == 0;
+                }
+            }
+            this->fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+            if (this->fd_ < 0) {
+                return false;
+            }
+            int size = 4 * 1024 * 1024;
+            setsockopt(this->fd_, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+            struct sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            return bind(this->fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0;
+        }
+        ~Receiver() {
+            if (this->fd_ >= 0) {
+                close(this->fd_);
+            }
+        }
+
+        // Next waiting datagram, false if there is none; source_port is the sender's port
+        bool receive(std::string *datagram, uint16_t *source_port = nullptr) {
+            char buffer[2048];
+            struct sockaddr_in6 from;  // Large enough for either family; both keep the port at the same offset
+            socklen_t from_len = sizeof(from);
+            ssize_t len = recvfrom(this->fd_, buffer, sizeof(buffer), MSG_DONTWAIT,
+                                   reinterpret_cast<struct sockaddr *>(&from), &from_len);
+            if (len < 0) {
+                return false;
+            }
+            datagram->assign(buffer, len);
+            if (source_port != nullptr) {
+                *source_port = ntohs(from.sin6_port);
+            }
+            return true;
+        }
+
+        // Throw away everything received so far
+        void drain() {
+            std::string datagram;
+            while (this->receive(&datagram)) {
+            }
+        }
+
+    protected:
+        int fd_ = -1;
+};
+
+// Run the component's loop() for a while, as the application would
+inline void pump(esphome::syslog::SyslogComponent *syslog, uint32_t duration_ms) {
+    uint32_t start = esphome::millis();
+    do {
+        syslog->loop();
+        usleep(1000);
+    } while (esphome::millis() - start < duration_ms);
+}
+
+// Number of datagrams whose text contains needle
+inline size_t count_containing(const std::vector<std::string> &datagrams, const std::string &needle) {
+    size_t count = 0;
+    for (const auto &datagram : datagrams) {
+        if (datagram.find(needle) != std::string::npos) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Everything the receiver has right now
+inline std::vector<std::string> receive_all(Receiver &receiver) {
+    std::vector<std::string> datagrams;
+    std::string datagram;
+    while (receiver.receive(&datagram)) {
+        datagrams.push_back(datagram);
+    }
+    return datagrams;
+}
+
+}  // namespace syslog_test